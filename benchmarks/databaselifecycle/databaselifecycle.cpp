@@ -0,0 +1,81 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "gams.h"
+#include "benchmark.h"
+#include <iostream>
+
+using namespace gams;
+using namespace std;
+
+/// Create a small database like a per-request input and drop it again
+void createDatabase(GAMSWorkspace &ws)
+{
+    GAMSDatabase db = ws.addDatabase();
+    GAMSParameter p = db.addParameter("p", 1, "input");
+    for (int i = 0; i < 10; ++i)
+        p.addRecord(to_string(i)).setValue(i);
+}
+
+/// \file databaselifecycle.cpp
+/// \brief Measures creating and destroying small GAMSDatabases. The handle pool of a workspace keeps
+/// the GMD library loaded, only the first database of a workspace pays for loading it.
+///
+/// Usage: databaselifecycle [system directory] [databases]
+int main(int argc, char* argv[])
+{
+    try {
+        GAMSWorkspaceInfo wsInfo;
+        if (argc > 1)
+            wsInfo.setSystemDirectory(argv[1]);
+        int databases = argc > 2 ? stoi(argv[2]) : 1000;
+
+        // the first database of a fresh workspace, the workspace is created outside of the measured time
+        vector<chrono::microseconds> coldTimes;
+        for (int i = 0; i < 5; ++i) {
+            GAMSWorkspace coldWs(wsInfo);
+            auto start = chrono::steady_clock::now();
+            createDatabase(coldWs);
+            coldTimes.push_back(chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start));
+        }
+        nth_element(coldTimes.begin(), coldTimes.begin() + coldTimes.size() / 2, coldTimes.end());
+        chrono::microseconds coldTime = coldTimes[coldTimes.size() / 2];
+
+        GAMSWorkspace ws(wsInfo);
+        chrono::microseconds residentTime = medianTime(databases, [&ws]() { createDatabase(ws); });
+
+        cout << "Median time to create and destroy a database with 10 records" << endl;
+        cout << "  first database of a workspace: " << coldTime.count() << " us" << endl;
+        cout << "  further databases:             " << residentTime.count() << " us" << endl;
+
+    } catch (GAMSException &ex) {
+        cout << "GAMSException occured: " << ex.what() << endl;
+        return 1;
+    } catch (exception &ex) {
+        cout << ex.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
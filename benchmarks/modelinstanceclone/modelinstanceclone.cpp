@@ -0,0 +1,77 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "gams.h"
+#include "benchmark.h"
+#include <filesystem>
+#include <iostream>
+
+using namespace gams;
+using namespace std;
+
+/// \file modelinstanceclone.cpp
+/// \brief Compares the time of copying a GAMSModelInstance with the scratch directories in the
+/// working directory and in a model instance directory, e.g. on a RAM disk.
+///
+/// Usage: modelinstanceclone [system directory] [model instance directory] [copies]
+int main(int argc, char* argv[])
+{
+    try {
+        GAMSWorkspaceInfo wsInfo;
+        if (argc > 1)
+            wsInfo.setSystemDirectory(argv[1]);
+        string miDir = argc > 2 ? argv[2] : filesystem::temp_directory_path().string();
+        int copies = argc > 3 ? stoi(argv[3]) : 50;
+
+        GAMSWorkspace ws(wsInfo);
+        GAMSCheckpoint cp = ws.addCheckpoint();
+        ws.addJobFromString(getModelText()).run(cp);
+
+        auto cloneTime = [&cp, copies]() {
+            GAMSModelInstance mi = cp.addModelInstance();
+            mi.instantiate("transport use lp min z");
+            // every copy is dropped again, so the directory does not grow
+            return medianTime(copies, [&mi]() { mi.copyModelInstance(); });
+        };
+
+        chrono::microseconds wdTime = cloneTime();
+        ws.setModelInstanceDirectory(miDir);
+        chrono::microseconds miTime = cloneTime();
+
+        cout << "Working directory:        " << ws.workingDirectory() << endl;
+        cout << "Model instance directory: " << miDir << endl;
+        cout << "Median clone time of " << copies << " copies" << endl;
+        cout << "  working directory:        " << wdTime.count() << " us" << endl;
+        cout << "  model instance directory: " << miTime.count() << " us" << endl;
+
+    } catch (GAMSException &ex) {
+        cout << "GAMSException occured: " << ex.what() << endl;
+        return 1;
+    } catch (exception &ex) {
+        cout << ex.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
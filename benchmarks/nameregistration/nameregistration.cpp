@@ -0,0 +1,74 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "gams.h"
+#include "benchmark.h"
+#include <iostream>
+#include <thread>
+
+using namespace gams;
+using namespace std;
+
+/// \file nameregistration.cpp
+/// \brief Measures the contention of registering default names from several threads of one
+/// GAMSWorkspace. Checkpoints are used since creating one does little more than registering its name.
+///
+/// Usage: nameregistration [system directory] [max threads] [names per thread]
+int main(int argc, char* argv[])
+{
+    try {
+        GAMSWorkspaceInfo wsInfo;
+        if (argc > 1)
+            wsInfo.setSystemDirectory(argv[1]);
+        int maxThreads = argc > 2 ? stoi(argv[2]) : int(max(4u, thread::hardware_concurrency()));
+        int names = argc > 3 ? stoi(argv[3]) : 10000;
+
+        GAMSWorkspace ws(wsInfo);
+        cout << "Median time to register " << names << " names per thread" << endl;
+        for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+            chrono::microseconds time = medianTime(5, [&ws, threadCount, names]() {
+                vector<thread> threads;
+                for (int t = 0; t < threadCount; ++t) {
+                    threads.emplace_back([&ws, names]() {
+                        for (int i = 0; i < names; ++i)
+                            ws.addCheckpoint();
+                    });
+                }
+                for (thread &t : threads)
+                    t.join();
+            });
+            cout << "  " << threadCount << " threads: " << time.count() << " us, "
+                 << double(threadCount) * names / max<long long>(1, time.count()) << " names/us" << endl;
+        }
+
+    } catch (GAMSException &ex) {
+        cout << "GAMSException occured: " << ex.what() << endl;
+        return 1;
+    } catch (exception &ex) {
+        cout << ex.what() << endl;
+        return 1;
+    }
+
+    return 0;
+}
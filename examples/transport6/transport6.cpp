@@ -25,24 +25,25 @@
 #include "gams.h"
 #include <vector>
 #include <iostream>
-#include <thread>
-#include <mutex>
 
 using namespace gams;
 using namespace std;
 
-/// Run the job with a different scenario
-void runScenario(GAMSWorkspace* ws, const GAMSCheckpoint& cp, mutex* ioMutex, double b)
+/// Start the job with a different scenario
+GAMSJobHandle startScenario(GAMSWorkspace* ws, const GAMSCheckpoint& cp, double b)
 {
     auto t6 = ws->addJobFromString("bmult=" + to_string(b) + "; solve transport min z use lp; ms=transport.modelstat; ss=transport.solvestat;", cp);
-    t6.run();
+    return t6.runAsync();
+}
 
-    // we need to make the ouput a critical section to avoid messed up report information
-    lock_guard<mutex> lck(*ioMutex);
+/// Wait for a scenario and report its results
+void reportScenario(GAMSJobHandle& handle, double b)
+{
+    GAMSDatabase outDB = handle.outDB();
     cout << "Scenario bmult=" << b << ":" << endl;
-    cout << "  Modelstatus: " << t6.outDB().getParameter("ms").findRecord().value() << endl;
-    cout << "  Solvestatus: " << t6.outDB().getParameter("ss").findRecord().value() << endl;
-    cout << "  Obj: " << t6.outDB().getVariable("z").findRecord().level() << endl;
+    cout << "  Modelstatus: " << outDB.getParameter("ms").findRecord().value() << endl;
+    cout << "  Solvestatus: " << outDB.getParameter("ss").findRecord().value() << endl;
+    cout << "  Obj: " << outDB.getVariable("z").findRecord().level() << endl;
 }
 
 /// Get model as string
@@ -118,13 +119,15 @@ int main(int argc, char* argv[])
 
         vector<double> bmultlist = { 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2, 1.3 };
 
-        // run multiple parallel jobs using the created GAMSCheckpoint
-        mutex ioMutex;
-        vector<thread> v;
+        // start multiple parallel jobs using the created GAMSCheckpoint, the GAMS processes
+        // run in the background without a thread per job
+        vector<GAMSJobHandle> handles;
         for(double b : bmultlist)
-            v.emplace_back([&ws, cp, &ioMutex, b]{runScenario(&ws, cp, &ioMutex, b);});
-        for (auto& t : v)
-            t.join();
+            handles.push_back(startScenario(&ws, cp, b));
+
+        // collect the results in the calling thread, so no locking is needed for the output
+        for (size_t i = 0; i < handles.size(); ++i)
+            reportScenario(handles[i], bmultlist[i]);
 
     } catch (GAMSException &ex) {
         cout << "GAMSException occured: " << ex.what() << endl;
@@ -24,51 +24,18 @@
  */
 #include "gams.h"
 #include <vector>
-#include <mutex>
-#include <thread>
 #include <iostream>
 
 using namespace gams;
 using namespace std;
 
-/// Solve the model in different scenarios
-void scenSolve(GAMSWorkspace* ws, GAMSCheckpoint* cp, vector<double>* bmultVector, std::mutex* vectorMutex, std::mutex* ioMutex)
+/// Results of one scenario
+struct ScenarioResult
 {
-    unique_lock<mutex> vectorLock(*vectorMutex);
-    GAMSModelInstance mi = cp->addModelInstance();
-    vectorLock.unlock();
-
-    GAMSParameter bmult = mi.syncDb().addParameter("bmult", "demand multiplier");
-    GAMSOptions opt = ws->addOptions();
-    opt.setAllModelTypes("cplex");
-    // instantiate the GAMSModelInstance and pass a model definition and GAMSModifier to declare bmult mutable
-    mi.instantiate("transport use lp min z", opt, GAMSModifier(bmult));
-
-    bmult.addRecord().setValue(1.0);
-
-    while (true)
-    {
-        double b;
-
-        // dynamically get a bmult value from the vector instead of passing it to the different threads at creation time
-        vectorLock.lock();
-        if (bmultVector->empty())
-            return;
-        b = bmultVector->back();
-        bmultVector->pop_back();
-        vectorLock.unlock();
-        bmult.firstRecord().setValue(b);
-        mi.solve();
-
-        // we need to make the output a critical section to avoid messed up report informations
-        unique_lock<mutex> ioLock(*ioMutex);
-        cout << "Scenario bmult=" << b << ":" << endl;
-        cout << "  Modelstatus: " << mi.modelStatus() << endl;
-        cout << "  Solvestatus: " << mi.solveStatus() << endl;
-        cout << "  Obj: " << mi.syncDb().getVariable("z").findRecord().level() << endl;
-        ioLock.unlock();
-    }
-}
+    GAMSEnum::ModelStat modelStatus;
+    GAMSEnum::SolveStat solveStatus;
+    double obj;
+};
 
 /// Get model as string
 string getModelText()
@@ -124,7 +91,7 @@ string getModelText()
 /// \brief This is the 8th model in a series of tutorial examples.
 ///
 /// Here we show:
-///   - How to use a vector to solve multiple GAMSModelInstances in parallel
+///   - How to use a GAMSModelInstancePool to solve multiple GAMSModelInstances in parallel
 int main(int argc, char* argv[])
 {
     cout << "---------- Transport 8 --------------" << endl;
@@ -139,16 +106,36 @@ int main(int argc, char* argv[])
         // initialize a GAMSCheckpoint by running a GAMSJob
         ws.addJobFromString(getModelText()).run(cp);
 
-        vector<double> bmultVector = { 1.3, 1.2, 1.1, 1.0, 0.9, 0.8, 0.7, 0.6 };
+        // instantiate the GAMSModelInstance once and pass a model definition and GAMSModifier to declare bmult mutable
+        GAMSModelInstance mi = cp.addModelInstance();
+        GAMSParameter bmult = mi.syncDb().addParameter("bmult", "demand multiplier");
+        GAMSOptions opt = ws.addOptions();
+        opt.setAllModelTypes("cplex");
+        mi.instantiate("transport use lp min z", opt, GAMSModifier(bmult));
+        bmult.addRecord().setValue(1.0);
+
+        // the pool copies the model instance for each of its worker threads
         int nrThreads = 2;
-        // solve multiple model instances in parallel
-        std::mutex vectorMutex;
-        std::mutex ioMutex;
-        vector<thread> v;
-        for (int i = 0; i < nrThreads; i++)
-            v.emplace_back([&ws, &cp, &bmultVector, &vectorMutex, &ioMutex] {scenSolve(&ws, &cp, &bmultVector, &vectorMutex, &ioMutex);});
-        for (auto& t : v)
-            t.join();
+        GAMSModelInstancePool pool(mi, nrThreads);
+
+        // scenarios are handed out to the workers one by one, the results are collected in scenario order
+        vector<double> bmultVector = { 1.3, 1.2, 1.1, 1.0, 0.9, 0.8, 0.7, 0.6 };
+        vector<ScenarioResult> results = pool.run<ScenarioResult>(static_cast<int>(bmultVector.size()),
+            [&bmultVector](GAMSModelInstance &worker, int scenario) {
+                worker.syncDb().getParameter("bmult").firstRecord().setValue(bmultVector[scenario]);
+                worker.solve();
+                return ScenarioResult { worker.modelStatus(), worker.solveStatus(),
+                                        worker.syncDb().getVariable("z").findRecord().level() };
+            });
+
+        for (size_t i = 0; i < bmultVector.size(); ++i) {
+            cout << "Scenario bmult=" << bmultVector[i] << ":" << endl;
+            cout << "  Modelstatus: " << results[i].modelStatus << endl;
+            cout << "  Solvestatus: " << results[i].solveStatus << endl;
+            cout << "  Obj: " << results[i].obj << endl;
+        }
+        cout << "Throughput: " << pool.throughput() << " scenarios/s, utilization: "
+             << pool.utilization() * 100 << "%" << endl;
 
     } catch (GAMSException &ex) {
         cout << "GAMSException occured: " << ex.what() << endl;
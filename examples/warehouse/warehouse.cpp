@@ -24,8 +24,6 @@
  */
 #include <iostream>
 #include <fstream>
-#include <mutex>
-#include <thread>
 #include "gams.h"
 
 using namespace gams;
@@ -107,59 +105,54 @@ string getModelText()
            "setResult('0');                                                                         \n";
 }
 
-void solveWarehouse(GAMSWorkspace* ws, int numberOfWarehouses, GAMSDatabase* resultDB, mutex* dbMutex)
+/// Submit the model for a number of warehouses to the scheduler
+GAMSJobHandle submitWarehouse(GAMSWorkspace* ws, GAMSJobScheduler* scheduler, int numberOfWarehouses)
 {
     GAMSJob gmsJ = ws->addJobFromString(getModelText());
-    try{
-        // instantiate GAMSOptions and define some scalars
-        GAMSOptions gmsOpt = ws->addOptions();
-        gmsOpt.setAllModelTypes("cplex");
-        gmsOpt.setDefine("Warehouse", to_string(numberOfWarehouses));
-        gmsOpt.setDefine("Store", "65");
-        gmsOpt.setDefine("fixed", "22");
-        gmsOpt.setDefine("disaggregate", "0");
-        gmsOpt.setOptCR(0.0);
 
-        // create a GAMSJob from string and write results to the result database
-        gmsJ.run(gmsOpt);
+    // instantiate GAMSOptions and define some scalars
+    GAMSOptions gmsOpt = ws->addOptions();
+    gmsOpt.setAllModelTypes("cplex");
+    gmsOpt.setDefine("Warehouse", to_string(numberOfWarehouses));
+    gmsOpt.setDefine("Store", "65");
+    gmsOpt.setDefine("fixed", "22");
+    gmsOpt.setDefine("disaggregate", "0");
+    gmsOpt.setOptCR(0.0);
 
-        // need to lock database write operations
-        {
-            lock_guard<mutex> dbLock(*dbMutex);
-            resultDB->getParameter("objrep").addRecord(to_string(numberOfWarehouses)).setValue(gmsJ.outDB().getVariable("obj").findRecord().level());
-        }
+    // the job is started as soon as the scheduler has a free slot
+    return scheduler->submit(gmsJ, gmsOpt);
+}
+
+/// Wait for the job of a number of warehouses and write its results to the result database
+void collectWarehouse(GAMSJobHandle& handle, int numberOfWarehouses, GAMSDatabase* resultDB)
+{
+    GAMSJob gmsJ = handle.job();
+    try{
+        handle.wait();
+
+        // the results are collected in the main thread, so no locking is needed
+        resultDB->getParameter("objrep").addRecord(to_string(numberOfWarehouses)).setValue(gmsJ.outDB().getVariable("obj").findRecord().level());
 
         for(GAMSVariableRecord supplyRec : gmsJ.outDB().getVariable("supply"))
         {
             if (supplyRec.level() > 0.5)
-            {
-                lock_guard<mutex> dbLock(*dbMutex);
                 resultDB->getSet("supplyMap").addRecord(to_string(numberOfWarehouses), supplyRec.key(0), supplyRec.key(1));
-            }
         }
     }
     catch(GAMSExceptionExecution& e)
     {
         if(e.rc() == GAMSEnum::ExecutionError)
-        {
-            lock_guard<mutex> dbLock(*dbMutex);
             statusString = gmsJ.outDB().getSet("res").findRecord(gmsJ.outDB().getSet("ares").firstRecord().key(0)).text();
-        }
-        {
-            lock_guard<mutex> dbLock(*dbMutex);
-            status = e.rc();
-        }
+        status = e.rc();
     }
     catch (GAMSException& e)
     {
         cout << e.what() << endl;
-        lock_guard<mutex> dbLock(*dbMutex);
         status = -1;
     }
     catch (exception& e)
     {
         cout << e.what() << endl;
-        lock_guard<mutex> dbLock(*dbMutex);
         status = -2;
     }
 }
@@ -170,8 +163,8 @@ void solveWarehouse(GAMSWorkspace* ws, int numberOfWarehouses, GAMSDatabase* res
 ///
 /// The model has been parameterized. The data can be derived from a few numbers namely
 /// the number of warehouses, stores, and some fixed cost scalar. The
-/// results of the model are written into a single result database that is
-/// protected across the parallel threads via a mutex.
+/// results of the model are written into a single result database. The jobs are run
+/// in parallel by a GAMSJobScheduler, which bounds the number of concurrent GAMS processes.
 int main(int argc, char* argv[])
 {
     cout << "---------- Warehouse --------------" << endl;
@@ -187,13 +180,13 @@ int main(int argc, char* argv[])
 
         resultDB.addParameter("objrep", 1, "Objective value");
         resultDB.addSet("supplyMap", 3, "Supply connection with level");
-        // run multiple parallel jobs
-        mutex dbMutex;
-        vector<thread> v;
+        // run multiple parallel jobs, at most one per hardware thread at a time
+        GAMSJobScheduler scheduler;
+        vector<GAMSJobHandle> handles;
+        for(int nrWarehouses=10; nrWarehouses<22; nrWarehouses++)
+            handles.push_back(submitWarehouse(&ws, &scheduler, nrWarehouses));
         for(int nrWarehouses=10; nrWarehouses<22; nrWarehouses++)
-            v.emplace_back([&ws, nrWarehouses, &resultDB, &dbMutex]{solveWarehouse(&ws, nrWarehouses, &resultDB, &dbMutex);});
-        for (auto& t : v)
-            t.join();
+            collectWarehouse(handles[nrWarehouses-10], nrWarehouses, &resultDB);
         if (status > 0)
             throw GAMSExceptionExecution("Error when running GAMS: " + GAMSEnum::text((GAMSEnum::GAMSExitCode) status) + " " + statusString, status, &ws);
         else if (status == -1)
@@ -30,13 +30,24 @@
 #include "gamsplatform.h"
 #include "gamsexception.h"
 #include "gamsexceptionexecution.h"
+#include "gamsexceptiontimeout.h"
 #include "gamsoptions.h"
 #include "gamsworkspaceinfo.h"
 #include "gamsworkspace.h"
 #include "gamsdatabase.h"
 #include "gamsjob.h"
+#include "gamsjobhandle.h"
+#include "gamsjobscheduler.h"
+#include "gamsjobstats.h"
 #include "gamscheckpoint.h"
 #include "gamsmodelinstance.h"
+#include "gamsmodelinstancepool.h"
+#include "gamsmodelinstancestats.h"
+#include "gamssolvehandle.h"
+#include "gamsbatchscenarios.h"
+#include "gamsbatchresults.h"
+#include "gamssolverprogress.h"
+#include "gamsscenariobatch.h"
 #include "gamsdomain.h"
 #include "gamsset.h"
 #include "gamsvariable.h"
@@ -0,0 +1,64 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsbatchresults.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+void GAMSBatchResults::addLevel(const GAMSSymbol &symbol, const vector<string> &keys)
+{
+    addColumn(symbol, keys, Level);
+}
+
+void GAMSBatchResults::addMarginal(const GAMSSymbol &symbol, const vector<string> &keys)
+{
+    addColumn(symbol, keys, Marginal);
+}
+
+void GAMSBatchResults::resize(int scenarios)
+{
+    modelStatus.resize(scenarios);
+    solveStatus.resize(scenarios);
+    objective.resize(scenarios);
+    for (Column &col : columns)
+        col.values.resize(scenarios);
+}
+
+void GAMSBatchResults::addColumn(const GAMSSymbol &symbol, const vector<string> &keys, Value value)
+{
+    if (!symbol.isValid())
+        throw GAMSException("GAMSBatchResults: The symbol has not been initialized.");
+    if (symbol.type() != GAMSEnum::SymbolType::SymTypeVar && symbol.type() != GAMSEnum::SymbolType::SymTypeEqu)
+        throw GAMSException("GAMSBatchResults: Symbol " + symbol.name() + " is neither a variable nor an equation");
+    if (static_cast<int>(keys.size()) != symbol.dim())
+        throw GAMSException("GAMSBatchResults: Different dimensions: " + to_string(keys.size()) + " vs. "
+                            + to_string(symbol.dim()));
+    columns.push_back(Column{symbol, keys, value, vector<double>(objective.size())});
+}
+
+} // namespace gams
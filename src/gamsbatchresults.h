@@ -0,0 +1,83 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSBATCHRESULTS_H
+#define GAMSBATCHRESULTS_H
+
+#include "gamslib_global.h"
+#include "gamsenum.h"
+#include "gamssymbol.h"
+#include <string>
+#include <vector>
+
+namespace gams {
+
+/// Results of GAMSModelInstance::solveBatch stored in columns with one entry per scenario.
+/// The buffers are resized to the number of scenarios by solveBatch and keep their capacity,
+/// so passing the same object to consecutive batches does not allocate again.
+struct LIBSPEC GAMSBatchResults
+{
+    /// Value of a variable or equation record
+    enum Value
+    {
+        Level = 0,      ///< Level of the record
+        Marginal        ///< Marginal of the record
+    };
+
+    /// Column of a captured variable or equation record
+    struct Column
+    {
+        GAMSSymbol symbol;              ///< Variable or equation in the sync database
+        std::vector<std::string> keys;  ///< Keys of the record
+        Value value;                    ///< Captured value
+        std::vector<double> values;     ///< Value of the record per scenario
+    };
+
+    /// Capture the level of a variable or equation record for every scenario.
+    /// \param symbol Variable or equation in the sync database of the model instance.
+    /// \param keys Keys of the record.
+    void addLevel(const GAMSSymbol &symbol, const std::vector<std::string> &keys = {});
+
+    /// Capture the marginal of a variable or equation record for every scenario.
+    /// \param symbol Variable or equation in the sync database of the model instance.
+    /// \param keys Keys of the record.
+    void addMarginal(const GAMSSymbol &symbol, const std::vector<std::string> &keys = {});
+
+    /// Resize all buffers to a number of scenarios.
+    /// \param scenarios Number of scenarios.
+    void resize(int scenarios);
+
+    std::vector<GAMSEnum::ModelStat> modelStatus;   ///< Model status per scenario
+    std::vector<GAMSEnum::SolveStat> solveStatus;   ///< Solve status per scenario
+    std::vector<double> objective;                  ///< Objective value per scenario
+    std::vector<Column> columns;                    ///< Captured variable and equation records
+
+private:
+    void addColumn(const GAMSSymbol &symbol, const std::vector<std::string> &keys, Value value);
+};
+
+} // namespace gams
+
+#endif // GAMSBATCHRESULTS_H
@@ -0,0 +1,51 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsbatchscenarios.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+void GAMSBatchScenarios::addColumn(const GAMSParameter &symbol, const vector<string> &keys, vector<double> values)
+{
+    if (!symbol.isValid())
+        throw GAMSException("GAMSBatchScenarios: The symbol has not been initialized.");
+    if (static_cast<int>(keys.size()) != symbol.dim())
+        throw GAMSException("GAMSBatchScenarios: Different dimensions: " + to_string(keys.size()) + " vs. "
+                            + to_string(symbol.dim()));
+    if (!columns.empty() && values.size() != columns.front().values.size())
+        throw GAMSException("GAMSBatchScenarios: Expected " + to_string(columns.front().values.size())
+                            + " values but got " + to_string(values.size()));
+    columns.push_back(Column{symbol, keys, std::move(values)});
+}
+
+int GAMSBatchScenarios::numberOfScenarios() const
+{
+    return columns.empty() ? 0 : static_cast<int>(columns.front().values.size());
+}
+
+} // namespace gams
@@ -0,0 +1,63 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSBATCHSCENARIOS_H
+#define GAMSBATCHSCENARIOS_H
+
+#include "gamslib_global.h"
+#include "gamsparameter.h"
+#include <string>
+#include <vector>
+
+namespace gams {
+
+/// Scenario data of GAMSModelInstance::solveBatch given as columns of modifier values.
+/// Each column supplies the value of one record of a modifier data symbol for every scenario.
+struct LIBSPEC GAMSBatchScenarios
+{
+    /// Column of values for one record of a data symbol
+    struct Column
+    {
+        GAMSParameter symbol;           ///< Data symbol of a GAMSModifier in the sync database
+        std::vector<std::string> keys;  ///< Keys of the record
+        std::vector<double> values;     ///< Value of the record per scenario
+    };
+
+    /// Add a column of values for one record of a modifier data symbol.
+    /// \param symbol Data symbol of a GAMSModifier in the sync database of the model instance.
+    /// \param keys Keys of the record; the record is added to the symbol if it does not exist.
+    /// \param values Value of the record per scenario.
+    void addColumn(const GAMSParameter &symbol, const std::vector<std::string> &keys, std::vector<double> values);
+
+    /// Get the number of scenarios.
+    /// \return Returns the number of values of the columns or 0 if there is no column.
+    int numberOfScenarios() const;
+
+    std::vector<Column> columns;        ///< Columns of scenario values
+};
+
+} // namespace gams
+
+#endif // GAMSBATCHSCENARIOS_H
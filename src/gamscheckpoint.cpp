@@ -55,6 +55,12 @@ GAMSModelInstance GAMSCheckpoint::addModelInstance(const std::string &modelInsta
     return mImpl->addModelInstance(*this, modelInstanceName);
 }
 
+GAMSScenarioBatch GAMSCheckpoint::addScenarioBatch(const std::string &scenarioSource)
+{
+    if (!mImpl) throw GAMSException("GAMSCheckpoint: The checkpoint has not been initialized.");
+    return mImpl->addScenarioBatch(*this, scenarioSource);
+}
+
 std::string GAMSCheckpoint::name()
 {
     if (!mImpl) throw GAMSException("GAMSCheckpoint: The checkpoint has not been initialized.");
@@ -34,6 +34,7 @@
 namespace gams {
 
 class GAMSModelInstance;
+class GAMSScenarioBatch;
 class GAMSCheckpointImpl;
 class GAMSWorkspace;
 
@@ -78,6 +79,11 @@ public:
     /// \returns Returns the GAMSModelInstance.
     GAMSModelInstance addModelInstance(const std::string& modelInstanceName = "");
 
+    /// Create a batch running many scenarios of the model in this checkpoint in one GAMS process.
+    /// \param scenarioSource GAMS code executed for every scenario, e.g. a solve statement.
+    /// \returns Returns the GAMSScenarioBatch.
+    GAMSScenarioBatch addScenarioBatch(const std::string& scenarioSource);
+
     /// Get the checkpoint name.
     /// \return Returns the checkpoint name.
     std::string name();
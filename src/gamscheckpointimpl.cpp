@@ -67,4 +67,9 @@ GAMSModelInstance GAMSCheckpointImpl::addModelInstance(GAMSCheckpoint& cp, const
     return GAMSModelInstance(cp, miName);
 }
 
+GAMSScenarioBatch GAMSCheckpointImpl::addScenarioBatch(GAMSCheckpoint& cp, const string& scenarioSource)
+{
+    return GAMSScenarioBatch(cp, scenarioSource);
+}
+
 }
@@ -29,6 +29,7 @@
 #include "gamslib_global.h"
 #include "gamsworkspace.h"
 #include "gamsmodelinstance.h"
+#include "gamsscenariobatch.h"
 
 namespace gams {
 
@@ -42,6 +43,7 @@ public:
     bool operator==(const GAMSCheckpointImpl& other) const;
 
     GAMSModelInstance addModelInstance(GAMSCheckpoint& cp, const std::string& modelInstanceName);
+    GAMSScenarioBatch addScenarioBatch(GAMSCheckpoint& cp, const std::string& scenarioSource);
 
     LogId logID() { return mWs.logID(); }
     GAMSWorkspace mWs;
@@ -33,6 +33,7 @@
 #include "gamsexception.h"
 #include "gamspath.h"
 #include "gamsdatabasedomainviolation.h"
+#include "gamsworkspaceimpl.h"
 
 using namespace std;
 
@@ -74,10 +75,7 @@ GAMSDatabaseImpl::GAMSDatabaseImpl(GAMSWorkspace& workspace, const double specVa
             throw GAMSException("Database with name " + mDatabaseName + " already exists");
     }
 
-    char msg[GMS_SSSIZE];
-    if (!gmdCreateD(&mGMD, mWs.systemDirectory().c_str(), msg, sizeof(msg))){
-        throw GAMSException(msg);
-    }
+    mGMD = mWs.mImpl->handlePool().createGmd(mWs.systemDirectory());
     //set debug mode
     if (mWs.debug() == GAMSEnum::DebugLevel::Verbose)
         checkForGMDError(gmdSetDebug(mGMD, 10), __FILE__, __LINE__);
@@ -117,7 +115,7 @@ GAMSDatabaseImpl::GAMSDatabaseImpl(void* gmdPtr, GAMSWorkspace& workspace)
 GAMSDatabaseImpl::~GAMSDatabaseImpl()
 {
     if (mGMD && mOwnGMD) {
-        gmdFree(&mGMD);
+        mWs.mImpl->handlePool().freeGmd(mGMD);
     }
 }
 
@@ -358,6 +356,37 @@ bool GAMSDatabaseImpl::recordLock()
     return mRecordLock;
 }
 
+void GAMSDatabaseImpl::trackChanges(void *symPtr)
+{
+    if (!tracksChanges(symPtr))
+        mSymbolChanges[symPtr].all = true;
+}
+
+void GAMSDatabaseImpl::symbolChanged(void *symPtr)
+{
+    auto it = mSymbolChanges.find(symPtr);
+    if (it == mSymbolChanges.end())
+        return;
+    it->second.all = true;
+    it->second.records.clear();
+}
+
+void GAMSDatabaseImpl::recordChanged(void *symPtr, const vector<string> &keys)
+{
+    auto it = mSymbolChanges.find(symPtr);
+    if (it != mSymbolChanges.end() && !it->second.all)
+        it->second.records.insert(keys);
+}
+
+GAMSDatabaseImpl::SymbolChanges GAMSDatabaseImpl::takeChanges(void *symPtr)
+{
+    SymbolChanges taken;
+    auto it = mSymbolChanges.find(symPtr);
+    if (it != mSymbolChanges.end())
+        swap(taken, it->second);
+    return taken;
+}
+
 //GAMSSet GAMSDatabaseImpl::AddSet(const std::string& _identifier, const int _dimension, const std::string& _explanatoryText, const std::vector<std::string>& relaxedDomain)
 //{
 //   return GAMSSet(*this, _identifier, _dimension, _explanatoryText, relaxedDomain);
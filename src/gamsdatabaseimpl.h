@@ -29,6 +29,8 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <set>
 #include "gmdcc.h"
 #include "gamsworkspace.h"
 #include "gamsvariablerecord.h"
@@ -112,6 +114,27 @@ public:
     bool symbolLock();
     bool recordLock();
 
+    /// Modifications of a tracked symbol since they were taken the last time
+    struct SymbolChanges
+    {
+        /// Keys of the added, modified and deleted records
+        std::set<std::vector<std::string>> records;
+        /// The symbol has been modified as a whole, e.g. cleared or copied into
+        bool all = false;
+    };
+
+    /// Start keeping the modifications of a symbol; until they are taken the first time, the
+    /// whole symbol counts as modified
+    void trackChanges(void *symPtr);
+    /// Check if the modifications of a symbol are kept
+    bool tracksChanges(void *symPtr) const { return mSymbolChanges.count(symPtr) > 0; }
+    /// Record a modification of a symbol as a whole
+    void symbolChanged(void *symPtr);
+    /// Record a modification of one record of a symbol
+    void recordChanged(void *symPtr, const std::vector<std::string> &keys);
+    /// Get and reset the modifications of a tracked symbol
+    SymbolChanges takeChanges(void *symPtr);
+
     GAMSWorkspace mWs;
     std::string mInModelName;
     std::string mDatabaseName;
@@ -122,6 +145,7 @@ private:
     bool mOwnGMD = true;
     bool mRecordLock = false;
     bool mSymbolLock = false;
+    std::unordered_map<void*, SymbolChanges> mSymbolChanges;
 };
 
 } // namespace gams
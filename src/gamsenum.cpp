@@ -120,6 +120,12 @@ std::string GAMSEnum::text(GAMSEnum::EAction type)
     return res[type];
 }
 
+std::string GAMSEnum::text(GAMSEnum::JobStatus type)
+{
+    const char * res[] = {"JobRunning","JobFinished","JobFailed","JobCancelled","JobTimedOut","JobQueued"};
+    return res[type];
+}
+
 std::string GAMSEnum::code(GAMSEnum::EAction type)
 {
     const char * res[] = { "R", "C", "E", "CE", "G", "GT" };
@@ -234,6 +234,20 @@ public:
     /// Get a <c>GAMSEnum::EAction</c> from a <c>std::string</c>.
     static EAction eActionFromCode(const std::string &str);
 
+    /// Status of a GAMSJob started with GAMSJob::runAsync
+    enum JobStatus
+    {
+        JobRunning = 0,     ///< GAMS is still running
+        JobFinished,        ///< GAMS finished with return code 0
+        JobFailed,          ///< GAMS finished with a return code other than 0
+        JobCancelled,       ///< The job has been stopped by GAMSJobHandle::cancel
+        JobTimedOut,        ///< The job has been stopped because it exceeded its time limit
+        JobQueued           ///< The job waits in a GAMSJobScheduler for being started
+    };
+
+    /// Get a <c>GAMSEnum::JobStatus</c> as text.
+    static std::string text(GAMSEnum::JobStatus type);
+
 };
 
 }
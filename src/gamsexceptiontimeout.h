@@ -0,0 +1,52 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSEXCEPTIONTIMEOUT_H
+#define GAMSEXCEPTIONTIMEOUT_H
+
+#include "gamsexceptionexecution.h"
+
+namespace gams {
+
+/// Exception class thrown when a GAMSJob exceeds its time limit and has been stopped.
+class LIBSPEC GAMSExceptionTimeout : public GAMSExceptionExecution
+{
+public:
+    /// Constructor.
+    /// \param what Exception message.
+    /// \param exitCode Exit Code of the stopped process.
+    /// \param ws Active GAMSWorkspace.
+    GAMSExceptionTimeout(const std::string& what, int exitCode, GAMSWorkspace* ws = nullptr);
+
+    /// Constructor.
+    /// \param what Exception message.
+    /// \param exitCode Exit Code of the stopped process.
+    /// \param ws Active GAMSWorkspace.
+    GAMSExceptionTimeout(const char* what, int exitCode, GAMSWorkspace* ws = nullptr);
+};
+
+} // namespace gams
+
+#endif // GAMSEXCEPTIONTIMEOUT_H
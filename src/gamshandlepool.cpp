@@ -0,0 +1,100 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamshandlepool.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSHandlePool::~GAMSHandlePool()
+{
+    if (mResidentGmo)
+        gmoFree(&mResidentGmo);
+    if (mResidentGev)
+        gevFree(&mResidentGev);
+    if (mResidentGmd)
+        gmdFree(&mResidentGmd);
+}
+
+gmdHandle_t GAMSHandlePool::createGmd(const string &systemDir)
+{
+    char msg[GMS_SSSIZE];
+    {
+        lock_guard<mutex> lck(mLock);
+        if (!mResidentGmd && !gmdCreateD(&mResidentGmd, systemDir.c_str(), msg, sizeof(msg)))
+            throw GAMSException(msg);
+    }
+    gmdHandle_t gmd = nullptr;
+    if (!gmdCreateD(&gmd, systemDir.c_str(), msg, sizeof(msg)))
+        throw GAMSException(msg);
+    return gmd;
+}
+
+void GAMSHandlePool::freeGmd(gmdHandle_t &gmd)
+{
+    gmdFree(&gmd);
+}
+
+gevHandle_t GAMSHandlePool::createGev(const string &systemDir)
+{
+    char msg[GMS_SSSIZE];
+    {
+        lock_guard<mutex> lck(mLock);
+        if (!mResidentGev && !gevCreateD(&mResidentGev, systemDir.c_str(), msg, sizeof(msg)))
+            throw GAMSException(msg);
+    }
+    gevHandle_t gev = nullptr;
+    if (!gevCreateD(&gev, systemDir.c_str(), msg, sizeof(msg)))
+        throw GAMSException(msg);
+    return gev;
+}
+
+void GAMSHandlePool::freeGev(gevHandle_t &gev)
+{
+    gevFree(&gev);
+}
+
+gmoHandle_t GAMSHandlePool::createGmo(const string &systemDir)
+{
+    char msg[GMS_SSSIZE];
+    {
+        lock_guard<mutex> lck(mLock);
+        if (!mResidentGmo && !gmoCreateD(&mResidentGmo, systemDir.c_str(), msg, sizeof(msg)))
+            throw GAMSException(msg);
+    }
+    gmoHandle_t gmo = nullptr;
+    if (!gmoCreateD(&gmo, systemDir.c_str(), msg, sizeof(msg)))
+        throw GAMSException(msg);
+    return gmo;
+}
+
+void GAMSHandlePool::freeGmo(gmoHandle_t &gmo)
+{
+    gmoFree(&gmo);
+}
+
+} // namespace gams
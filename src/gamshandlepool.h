@@ -0,0 +1,75 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSHANDLEPOOL_H
+#define GAMSHANDLEPOOL_H
+
+#include <string>
+#include <mutex>
+#include "gmdcc.h"
+#include "gevmcc.h"
+#include "gmomcc.h"
+
+namespace gams {
+
+/// Creates and frees the GMD, GEV and GMO handles of the objects of a workspace.
+/// <p>The libraries behind the handles are unloaded when their last handle is freed, so the
+/// pool keeps one handle of every library it has loaded until the pool is destroyed. The
+/// handles of the objects themselves are not reused: GMD can't drop the symbols and labels of a
+/// database, so they are freed like before.</p>
+class GAMSHandlePool
+{
+public:
+    /// Frees the handles keeping the libraries loaded
+    ~GAMSHandlePool();
+
+    /// Create a GMD handle.
+    /// \param systemDir GAMS system directory to load the library from.
+    gmdHandle_t createGmd(const std::string &systemDir);
+    /// Free a GMD handle.
+    void freeGmd(gmdHandle_t &gmd);
+
+    /// Create a GEV handle.
+    /// \param systemDir GAMS system directory to load the library from.
+    gevHandle_t createGev(const std::string &systemDir);
+    /// Free a GEV handle.
+    void freeGev(gevHandle_t &gev);
+
+    /// Create a GMO handle.
+    /// \param systemDir GAMS system directory to load the library from.
+    gmoHandle_t createGmo(const std::string &systemDir);
+    /// Free a GMO handle.
+    void freeGmo(gmoHandle_t &gmo);
+
+private:
+    std::mutex mLock;
+    gmdHandle_t mResidentGmd = nullptr;
+    gevHandle_t mResidentGev = nullptr;
+    gmoHandle_t mResidentGmo = nullptr;
+};
+
+} // namespace gams
+
+#endif // GAMSHANDLEPOOL_H
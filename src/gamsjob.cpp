@@ -25,6 +25,8 @@
 
 #include "gamsjobimpl.h"
 #include "gamsjob.h"
+#include "gamsjobhandle.h"
+#include "gamsjobhandleimpl.h"
 #include "gamscheckpoint.h"
 
 using namespace std;
@@ -110,6 +112,57 @@ void GAMSJob::run(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint
     mImpl->run(&gamsOptions, (gamsCheckpoint.isValid() ? &gamsCheckpoint : nullptr), &output, createOutDB, databases);
 }
 
+void GAMSJob::run(GAMSOptions& gamsOptions, std::chrono::milliseconds timeLimit)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    mImpl->run(&gamsOptions, nullptr, nullptr, true, {}, timeLimit);
+}
+
+void GAMSJob::run(GAMSOptions& gamsOptions, std::chrono::milliseconds timeLimit, std::ostream& outstream)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    mImpl->run(&gamsOptions, nullptr, &outstream, true, {}, timeLimit);
+}
+
+void GAMSJob::run(GAMSOptions& gamsOptions, const LogLineHandler& onLogLine, size_t maxBufferedLines)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    if (!onLogLine) throw GAMSException("GAMSJob: The log line callback must not be empty.");
+    mImpl->run(&gamsOptions, onLogLine, maxBufferedLines);
+}
+
+GAMSJobHandle GAMSJob::runAsync()
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(mImpl, mImpl->startRun(nullptr, nullptr, nullptr, true, {},
+                                                                               chrono::milliseconds::zero())));
+}
+
+GAMSJobHandle GAMSJob::runAsync(GAMSOptions& gamsOptions)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(mImpl, mImpl->startRun(&gamsOptions, nullptr, nullptr, true, {},
+                                                                               chrono::milliseconds::zero())));
+}
+
+GAMSJobHandle GAMSJob::runAsync(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(mImpl, mImpl->startRun(&gamsOptions,
+                         (gamsCheckpoint.isValid() ? &gamsCheckpoint : nullptr), nullptr, true, {},
+                         chrono::milliseconds::zero())));
+}
+
+GAMSJobHandle GAMSJob::runAsync(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint, std::ostream* output,
+                                bool createOutDB, const std::vector<GAMSDatabase> &databases,
+                                std::chrono::milliseconds timeLimit)
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(mImpl, mImpl->startRun(&gamsOptions,
+                         (gamsCheckpoint.isValid() ? &gamsCheckpoint : nullptr), output, createOutDB, databases,
+                         timeLimit)));
+}
+
 void GAMSJob::runEngine(const GAMSEngineConfiguration &engineConfiguration, GAMSOptions* gamsOptions,
                         GAMSCheckpoint* checkpoint, std::ostream* output,
                         const std::vector<gams::GAMSDatabase> &databases, const std::set<std::string> &extraModelFiles, const std::unordered_map<std::string, std::string> &engineOptions,
@@ -145,6 +198,12 @@ GAMSDatabase GAMSJob::outDB()
     return mImpl->outDB();
 }
 
+GAMSJobStats GAMSJob::lastRunStats()
+{
+    if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
+    return mImpl->lastRunStats();
+}
+
 bool GAMSJob::interrupt()
 {
     if (!mImpl) throw GAMSException("GAMSJob: This job has not been initialized.");
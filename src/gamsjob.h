@@ -32,7 +32,11 @@
 #include <vector>
 #include <set>
 #include <unordered_map>
+#include <chrono>
+#include <functional>
 #include "gamsengineconfiguration.h"
+#include "gamsjobhandle.h"
+#include "gamsjobstats.h"
 
 namespace gams {
 
@@ -42,6 +46,7 @@ class GAMSJobImpl;
 class GAMSOptions;
 class GAMSCheckpoint;
 class GAMSDatabase;
+class GAMSJobHandle;
 
 /// <p>The GAMSJob class manages the execution of a GAMS program given by GAMS model
 /// source. The GAMS source (or more precisely the root of a model source tree) of
@@ -57,6 +62,10 @@ class GAMSDatabase;
 /// In case of a compilation or execution error, the Run method will throw an
 /// exception. If the log output of GAMS is of interest, it can be captured by
 /// providing a TextWriter instance.</p>
+/// <p>On Linux and macOS, GAMS runs in its own process group, so interrupt() and the time
+/// limits also reach the solvers started by GAMS. Therefore a Ctrl+C in the terminal only
+/// stops the application: GAMS jobs still running keep going unless the application
+/// interrupts them, e.g. from its own signal handler.</p>
 class LIBSPEC GAMSJob
 {
 public:
@@ -88,6 +97,8 @@ public:
     //TODO: complete run methods
 
     /// Run GAMSJob.
+    /// \remark GAMS runs in its own process group and is not stopped by a Ctrl+C in the terminal
+    ///         (see the class description).
     void run();
 
     /// Run GAMSJob.
@@ -126,6 +137,64 @@ public:
     void run(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint, std::ostream& output,
              bool createOutDB, const std::vector<gams::GAMSDatabase> &databases);
 
+    /// Run GAMSJob with a wall-clock time limit. If GAMS is still running when the limit is
+    /// reached, the job is interrupted, then terminated and finally killed, and a
+    /// GAMSExceptionTimeout is thrown.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param timeLimit Maximum wall-clock time of the GAMS run.
+    void run(GAMSOptions& gamsOptions, std::chrono::milliseconds timeLimit);
+
+    /// Run GAMSJob with a wall-clock time limit. If GAMS is still running when the limit is
+    /// reached, the job is interrupted, then terminated and finally killed, and a
+    /// GAMSExceptionTimeout is thrown.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param timeLimit Maximum wall-clock time of the GAMS run.
+    /// \param outstream Stream to capture GAMS log.
+    void run(GAMSOptions& gamsOptions, std::chrono::milliseconds timeLimit, std::ostream& outstream);
+
+    /// Callback receiving one line of the GAMS log without the line break.
+    typedef std::function<void(const std::string& line)> LogLineHandler;
+
+    /// Run GAMSJob and pass the GAMS log line by line to a callback while GAMS is running,
+    /// e.g. to parse iteration counts or the gap of a long solve.
+    /// <p>The callback is called from the calling thread. Lines it has not processed yet are
+    /// buffered; when <c>maxBufferedLines</c> are waiting, reading the log is paused until the
+    /// callback catches up, so a slow callback eventually slows down GAMS instead of letting
+    /// the buffer grow. If the callback throws, GAMS is stopped and the exception is rethrown.</p>
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param onLogLine Callback receiving the log lines.
+    /// \param maxBufferedLines Number of buffered log lines at which reading the log is paused. This is
+    ///        a soft limit: it is checked before each read of the log, and the lines of one read
+    ///        (up to 1 MiB of log) are always buffered completely.
+    void run(GAMSOptions& gamsOptions, const LogLineHandler& onLogLine, std::size_t maxBufferedLines = 1000);
+
+    /// Start GAMSJob without waiting for GAMS to finish.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle runAsync();
+
+    /// Start GAMSJob without waiting for GAMS to finish.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle runAsync(GAMSOptions& gamsOptions);
+
+    /// Start GAMSJob without waiting for GAMS to finish.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param gamsCheckpoint GAMSCheckpoint to be created by GAMSJob.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle runAsync(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint);
+
+    /// Start GAMSJob without waiting for GAMS to finish.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param gamsCheckpoint GAMSCheckpoint to be created by GAMSJob.
+    /// \param output Stream to capture GAMS log, written from a library thread while GAMS is running.
+    /// \param createOutDB Flag that activates writing to outDB.
+    /// \param databases GAMSDatabases read by the GAMSJob.
+    /// \param timeLimit Maximum wall-clock time of the GAMS run (zero for no limit).
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle runAsync(GAMSOptions& gamsOptions, const GAMSCheckpoint &gamsCheckpoint, std::ostream* output,
+                           bool createOutDB = true, const std::vector<gams::GAMSDatabase> &databases = {},
+                           std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero());
+
     /// Run GAMSJob on GAMS Engine
     /// \param engineConfiguration GAMSEngineConfiguration object
     /// \param extraModelFiles Set of additional file paths (apart from main file) required to run the model (e.g. include files)
@@ -143,9 +212,14 @@ public:
                    const std::unordered_map<std::string, std::string> &engineOptions = {},
                     bool createOutDB = true, bool removeResults = true);
 
-    /// Get GAMSDatabase created by Run method
+    /// Get GAMSDatabase created by Run method. The result GDX file is only read on the first
+    /// call after a run, so jobs whose results are never accessed do not pay for loading them.
     GAMSDatabase outDB();
 
+    /// Get the timings and byte counts of the last local run that has finished.
+    /// \return Returns the statistics of the last run (all zero if the job has not been run).
+    GAMSJobStats lastRunStats();
+
     /// Retrieve name of GAMSJob
     std::string name();
 
@@ -153,7 +227,6 @@ public:
     GAMSWorkspace workspace();
 
     /// Send interrupt signal to running GAMSJob
-    /// Note: On Mac OS using Mono this call requires the tool pstree to be installed
     /// @returns Returns <c>true</c> when the interrupt signal was sent and <c>false</c> when there is no Job running
     bool interrupt();
 
@@ -163,6 +236,9 @@ public:
 
 private:
     friend class GAMSWorkspaceImpl;
+    friend class GAMSJobHandle;
+    friend class GAMSJobScheduler;
+    friend class GAMSScenarioBatchImpl;
     GAMSJob(const std::shared_ptr<::gams::GAMSJobImpl>& impl);
     GAMSJob(gams::GAMSWorkspace &ws, const std::string& jobName = "", const std::string& fileName = ""
             , const GAMSCheckpoint *checkpoint = 0);
@@ -0,0 +1,88 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsjobhandle.h"
+#include "gamsjobhandleimpl.h"
+#include "gamsjobimpl.h"
+#include "gamsjob.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSJobHandle::GAMSJobHandle()
+{}
+
+GAMSJobHandle::GAMSJobHandle(const shared_ptr<GAMSJobHandleImpl>& impl)
+    : mImpl(impl)
+{}
+
+GAMSJobHandle::~GAMSJobHandle()
+{}
+
+bool GAMSJobHandle::isValid() const
+{
+    return bool(mImpl);
+}
+
+void GAMSJobHandle::wait()
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    mImpl->wait();
+}
+
+bool GAMSJobHandle::waitFor(chrono::milliseconds timeout)
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    return mImpl->waitFor(timeout);
+}
+
+bool GAMSJobHandle::cancel()
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    return mImpl->cancel();
+}
+
+GAMSEnum::JobStatus GAMSJobHandle::status() const
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    return mImpl->status();
+}
+
+GAMSDatabase GAMSJobHandle::outDB()
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    mImpl->wait();
+    return mImpl->mJob->outDB();
+}
+
+GAMSJob GAMSJobHandle::job() const
+{
+    if (!mImpl) throw GAMSException("GAMSJobHandle: This job handle has not been initialized.");
+    return GAMSJob(mImpl->mJob);
+}
+
+} // namespace gams
@@ -0,0 +1,99 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSJOBHANDLE_H
+#define GAMSJOBHANDLE_H
+
+#include "gamslib_global.h"
+#include <memory>
+#include <chrono>
+#include "gamsenum.h"
+
+namespace gams {
+
+class GAMSJob;
+class GAMSDatabase;
+class GAMSJobHandleImpl;
+
+/// <p>The GAMSJobHandle class represents a GAMSJob started with GAMSJob::runAsync. The
+/// GAMS process runs in the background and is supervised by a single library thread, so
+/// many jobs can be running without blocking one thread per job.</p>
+/// <p>The results of the run are evaluated by wait() (or any method that waits, like
+/// outDB()) in the calling thread. Errors of the GAMS run are thrown from there as
+/// GAMSExceptionExecution or GAMSExceptionTimeout, just like GAMSJob::run would.</p>
+/// <p>A GAMSJob runs only once at a time: until the result of a run has been evaluated,
+/// GAMSJob::run, GAMSJob::runAsync and GAMSJobScheduler::submit throw a GAMSException for
+/// the same job.</p>
+class LIBSPEC GAMSJobHandle
+{
+public:
+    /// Default constructor.
+    GAMSJobHandle();
+
+    /// Destructor. The last handle referencing a job blocks until GAMS has exited and evaluates
+    /// the result. Errors of the run are dropped, call wait() before to receive them.
+    ~GAMSJobHandle();
+
+    /// Check if a GAMSJobHandle is valid.
+    /// \return Returns <c>true</c> if the GAMSJobHandle is valid; otherwise <c>false</c>.
+    bool isValid() const;
+
+    /// Block until the job has finished and evaluate its results.
+    /// Throws a GAMSExceptionExecution if GAMS failed or the job has been cancelled, and a
+    /// GAMSExceptionTimeout if the job exceeded its time limit.
+    void wait();
+
+    /// Block until the job has finished or the timeout expired.
+    /// \param timeout Maximum time to wait.
+    /// \return Returns <c>true</c> if the job has finished (and its results are evaluated like
+    ///         in wait()); otherwise <c>false</c>.
+    bool waitFor(std::chrono::milliseconds timeout);
+
+    /// Stop the job. The GAMS process is interrupted, then terminated and finally killed if it
+    /// does not end. A following wait() throws a GAMSExceptionExecution.
+    /// \return Returns <c>true</c> if the job was still running; otherwise <c>false</c>.
+    bool cancel();
+
+    /// Get the status of the job without blocking.
+    GAMSEnum::JobStatus status() const;
+
+    /// Wait for the job and get the GAMSDatabase created by the run.
+    GAMSDatabase outDB();
+
+    /// Get the GAMSJob that is run.
+    GAMSJob job() const;
+
+private:
+    friend class GAMSJob;
+    friend class GAMSJobScheduler;
+    GAMSJobHandle(const std::shared_ptr<GAMSJobHandleImpl>& impl);
+
+private:
+    std::shared_ptr<GAMSJobHandleImpl> mImpl;
+};
+
+} // namespace gams
+
+#endif // GAMSJOBHANDLE_H
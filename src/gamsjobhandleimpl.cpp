@@ -0,0 +1,109 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsjobhandleimpl.h"
+#include "gamsjobimpl.h"
+#include "gamsprocessreaper.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSJobHandleImpl::GAMSJobHandleImpl(const shared_ptr<GAMSJobImpl> &job, const shared_ptr<GAMSJobRun> &jobRun)
+    : mJob(job), mRun(jobRun)
+{}
+
+GAMSJobHandleImpl::~GAMSJobHandleImpl()
+{
+    try {
+        wait();
+    } catch (...) {
+        // the owner dropped the handle without asking for the result
+    }
+}
+
+void GAMSJobHandleImpl::wait()
+{
+    {
+        unique_lock<mutex> lck(mRun->mLock);
+        mRun->mFinished.wait(lck, [this] { return mRun->mDone; });
+    }
+    finish();
+}
+
+bool GAMSJobHandleImpl::waitFor(chrono::milliseconds timeout)
+{
+    {
+        unique_lock<mutex> lck(mRun->mLock);
+        if (!mRun->mFinished.wait_for(lck, timeout, [this] { return mRun->mDone; }))
+            return false;
+    }
+    finish();
+    return true;
+}
+
+bool GAMSJobHandleImpl::cancel()
+{
+    shared_ptr<GAMSProcess> process;
+    {
+        lock_guard<mutex> lck(mRun->mLock);
+        if (mRun->mDone)
+            return false;
+        mRun->mCancelled = true;
+        process = mRun->mProcess;
+    }
+    if (process)
+        GAMSProcessReaper::instance().stop(process);
+    else // still queued, GAMS is never going to be started
+        mRun->complete(-1, true);
+    return true;
+}
+
+GAMSEnum::JobStatus GAMSJobHandleImpl::status() const
+{
+    lock_guard<mutex> lck(mRun->mLock);
+    if (!mRun->mDone)
+        return mRun->mProcess ? GAMSEnum::JobRunning : GAMSEnum::JobQueued;
+    if (mRun->mStopped)
+        return mRun->mCancelled ? GAMSEnum::JobCancelled : GAMSEnum::JobTimedOut;
+    return mRun->mExitCode == 0 ? GAMSEnum::JobFinished : GAMSEnum::JobFailed;
+}
+
+void GAMSJobHandleImpl::finish()
+{
+    lock_guard<mutex> lck(mFinishLock);
+    if (!mFinished) {
+        mFinished = true;
+        try {
+            mJob->finishRun(*mRun);
+        } catch (...) {
+            mError = current_exception();
+        }
+    }
+    if (mError)
+        rethrow_exception(mError);
+}
+
+} // namespace gams
@@ -0,0 +1,67 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSJOBHANDLEIMPL_H
+#define GAMSJOBHANDLEIMPL_H
+
+#include <memory>
+#include <mutex>
+#include <exception>
+#include <chrono>
+#include "gamsenum.h"
+
+namespace gams {
+
+class GAMSJobImpl;
+struct GAMSJobRun;
+
+class GAMSJobHandleImpl
+{
+public:
+    GAMSJobHandleImpl(const std::shared_ptr<GAMSJobImpl> &job, const std::shared_ptr<GAMSJobRun> &jobRun);
+
+    /// Waits for the run and evaluates it, errors are dropped here
+    ~GAMSJobHandleImpl();
+
+    void wait();
+    bool waitFor(std::chrono::milliseconds timeout);
+    bool cancel();
+    GAMSEnum::JobStatus status() const;
+
+    std::shared_ptr<GAMSJobImpl> mJob;
+    std::shared_ptr<GAMSJobRun> mRun;
+
+private:
+    /// Evaluates the finished run once and rethrows its error on every call
+    void finish();
+
+    std::mutex mFinishLock;
+    bool mFinished = false;
+    std::exception_ptr mError;
+};
+
+} // namespace gams
+
+#endif // GAMSJOBHANDLEIMPL_H
@@ -25,25 +25,93 @@
 
 #include <cpr/cpr.h>
 #include "gamsjobimpl.h"
+#include "gamsworkspaceimpl.h"
 #include "gamscheckpoint.h"
 #include "gamslog.h"
 #include "gamsoptions.h"
 #include "gamsplatform.h"
+#include "gamsprocess.h"
+#include "gamsprocessreaper.h"
 #include "gamspath.h"
 #include "gamsoptions.h"
 #include "gamsexceptionexecution.h"
+#include "gamsexceptiontimeout.h"
 
 #include <sstream>
 #include <fstream>
 #include <iostream>
 #include <array>
+#include <algorithm>
 #include <nlohmann/json.hpp>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 using namespace std::string_literals;
 
 namespace gams {
 
+// options changing from run to run, they affect neither the compiled program nor a shared option file
+static const set<string> cRunOptions = { "gdx", "input", "i", "output", "o", "logfile", "lf",
+                                         "logoption", "lo", "curdir", "cdir", "save", "s",
+                                         "restart", "r", "action", "a", "scrdir", "sd" };
+
+/// Splits the lines of an option file into command line arguments for the options specific
+/// to a run and the text of all other options
+static void splitOptions(const string &options, vector<string> &runArgs, string &sharedOptions)
+{
+    istringstream pf(options);
+    string line;
+    while (getline(pf, line)) {
+        size_t sep = line.find_first_of("= \t");
+        string option = line.substr(0, sep);
+        // GAMS option names are case insensitive, e.g. Input or LogFile
+        transform(option.begin(), option.end(), option.begin(),
+                  [](unsigned char c) { return static_cast<char>(tolower(c)); });
+        if (!cRunOptions.count(option)) {
+            sharedOptions += line + '\n';
+        } else if (sep != string::npos) {
+            size_t value = line.find_first_not_of("= \t", sep);
+            runArgs.push_back(option + "=" + (value == string::npos ? "" : line.substr(value)));
+        }
+    }
+}
+
+static string readFile(const string &fileName)
+{
+    ifstream file(fileName, ios::binary);
+    ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+string GAMSJobImpl::optionFileText(GAMSOptions &options, const string &tmpFileName)
+{
+#ifdef __linux__
+    int fd = memfd_create("gamspf", MFD_CLOEXEC);
+    if (fd >= 0) {
+        options.writeOptionFile("/proc/self/fd/" + to_string(fd));
+        string text;
+        array<char, 4096> buffer;
+        ssize_t n;
+        off_t offset = 0;
+        while ((n = pread(fd, buffer.data(), buffer.size(), offset)) > 0) {
+            text.append(buffer.data(), static_cast<size_t>(n));
+            offset += n;
+        }
+        close(fd);
+        return text;
+    }
+#endif
+    options.writeOptionFile(tmpFileName);
+    string text = readFile(tmpFileName);
+    error_code ec;
+    filesystem::remove(tmpFileName, ec);
+    return text;
+}
+
 GAMSJobImpl::GAMSJobImpl(GAMSWorkspace& workspace,
                          const string& jobName,
                          const string& fileName,
@@ -70,9 +138,34 @@ bool GAMSJobImpl::operator==(const GAMSJobImpl& other) const
 
 GAMSDatabase GAMSJobImpl::outDB()
 {
+    lock_guard<mutex> lck(mOutDbLock);
+    if (!mOutDbFile.empty()) {
+        auto loadStart = chrono::steady_clock::now();
+        mOutDb = mWs.addDatabaseFromGDXForcedName(mOutDbFile, GAMSPath(mOutDbFile).suffix("").filename().string(), "");
+        auto loadTime = chrono::steady_clock::now() - loadStart;
+        mOutDbFile.clear();
+
+        GAMSJobStats before;
+        GAMSJobStats after;
+        {
+            lock_guard<mutex> lck(mStatsLock);
+            before = mLastRunStats;
+            mLastRunStats.outDBLoadTime = loadTime;
+            after = mLastRunStats;
+        }
+        mWs.mImpl->amendJobStats(before, after);
+    }
     return mOutDb;
 }
 
+void GAMSJobImpl::setOutDbFile(const string &gdxFile)
+{
+    // the result GDX is read on the first call of outDB(), jobs not asking for it pay nothing
+    lock_guard<mutex> lck(mOutDbLock);
+    mOutDb = GAMSDatabase();
+    mOutDbFile = gdxFile;
+}
+
 GAMSJobImpl::~GAMSJobImpl() {
     delete mEngineJob;
     delete mCheckpointStart; // this is intended to only free the wrapper, not the *Impl if used anywhere
@@ -81,6 +174,19 @@ GAMSJobImpl::~GAMSJobImpl() {
 string GAMSJobImpl::prepareRun(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
                                const GAMSCheckpoint* checkpoint, ostream* output, bool createOutDb,
                                bool relativePaths, set<string> *dbPaths, const vector<GAMSDatabase> &databases)
+{
+    prepareOptions(tmpOptions, tmpCP, checkpoint, output, createOutDb, relativePaths, dbPaths, databases);
+
+    filesystem::path pfFile = mWs.workingDirectory();
+    pfFile /= mJobName + ".pf";
+    tmpOptions.writeOptionFile(pfFile.string());
+
+    return pfFile.string();
+}
+
+void GAMSJobImpl::prepareOptions(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
+                                 const GAMSCheckpoint* checkpoint, ostream* output, bool createOutDb,
+                                 bool relativePaths, set<string> *dbPaths, const vector<GAMSDatabase> &databases)
 {
     // TODO (RG): check if tmpCP needs to be deleted
 
@@ -121,6 +227,8 @@ string GAMSJobImpl::prepareRun(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
             if (dbPaths) dbPaths->insert(p.string());
 
             db.doExport();
+            if (mWs.debug() < GAMSEnum::DebugLevel::KeepFiles)
+                mWs.mImpl->scratchCleaner().add(db.mImpl, { p.string() });
             if (db.inModelName() != "")
                 tmpOptions.setDefine(db.inModelName(), db.name());
         }
@@ -142,48 +250,431 @@ string GAMSJobImpl::prepareRun(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
         tmpOptions.setCurDir(mWs.workingDirectory());
         tmpOptions.setInput(mFileName);
     }
+}
 
-    filesystem::path pfFile = mWs.workingDirectory();
-    pfFile /= mJobName + ".pf";
-    tmpOptions.writeOptionFile(pfFile.string());
+void GAMSJobImpl::run(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
+                      ostream* output, bool createOutDb, const vector<GAMSDatabase> &databases,
+                      chrono::milliseconds timeLimit)
+{
+    shared_ptr<GAMSJobRun> jobRun = startRun(gamsOpt, checkpoint, output, createOutDb, databases, timeLimit);
+    {
+        unique_lock<mutex> lck(jobRun->mLock);
+        jobRun->mFinished.wait(lck, [&jobRun] { return jobRun->mDone; });
+    }
+    finishRun(*jobRun);
+}
 
-    return pfFile.string();
+void GAMSJobRun::complete(int exitCode, bool stopped)
+{
+    function<void()> onDone;
+    {
+        lock_guard<mutex> lck(mLock);
+        if (mDone)
+            return;
+        mExitCode = exitCode;
+        mStopped = stopped;
+        mDone = true;
+        // moved out, so references held by the callback do not outlive the run
+        onDone = std::move(mOnDone);
+        mOnDone = nullptr;
+    }
+    mFinished.notify_all();
+    if (onDone)
+        onDone();
 }
 
-void GAMSJobImpl::run(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
-                      ostream* output, bool createOutDb, const vector<GAMSDatabase> &databases)
+shared_ptr<GAMSJobRun> GAMSJobImpl::startRun(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
+                                             ostream* output, bool createOutDb,
+                                             const vector<GAMSDatabase> &databases,
+                                             chrono::milliseconds timeLimit)
+{
+    shared_ptr<GAMSJobRun> jobRun = createRun(gamsOpt, checkpoint, output, createOutDb, databases, timeLimit);
+    launchRun(jobRun);
+    return jobRun;
+}
+
+shared_ptr<GAMSJobRun> GAMSJobImpl::createRun(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
+                                              ostream* output, bool createOutDb,
+                                              const vector<GAMSDatabase> &databases,
+                                              chrono::milliseconds timeLimit)
+{
+    // the runs of a job share its option, log and listing files and its out database
+    {
+        lock_guard<mutex> lck(mProcessLock);
+        if (mRunActive)
+            throw GAMSException("GAMS job " + mJobName + " is already running");
+        mRunActive = true;
+    }
+    try {
+        return prepareJobRun(gamsOpt, checkpoint, output, createOutDb, databases, timeLimit);
+    } catch (...) {
+        lock_guard<mutex> lck(mProcessLock);
+        mRunActive = false;
+        throw;
+    }
+}
+
+shared_ptr<GAMSJobRun> GAMSJobImpl::prepareJobRun(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
+                                                  ostream* output, bool createOutDb,
+                                                  const vector<GAMSDatabase> &databases,
+                                                  chrono::milliseconds timeLimit)
+{
+    auto prepareStart = chrono::steady_clock::now();
+    auto jobRun = make_shared<GAMSJobRun>(mWs, gamsOpt);
+    jobRun->mDatabases = databases;
+    set<string> dbPaths;
+    jobRun->mScratchOutDb = createOutDb && jobRun->mOptions.gdx().empty();
+    GAMSPath pf(mWs.workingDirectory(), mJobName + ".pf");
+    bool shareOptionFile = mWs.mImpl->optionFileCache();
+    vector<string> runArgs;
+    string sharedOptions;
+    GAMSJobStats &stats = jobRun->mStats;
+    if (shareOptionFile) {
+        // the options are split in memory, the job gets no option file of its own
+        prepareOptions(jobRun->mOptions, jobRun->mTmpCheckpoint, checkpoint, output,
+                       createOutDb, false, &dbPaths, databases);
+        splitOptions(optionFileText(jobRun->mOptions, pf.toStdString()), runArgs, sharedOptions);
+        // the command line overrides the parameter file
+        jobRun->mArgs = { "dummy", "pf=" + sharedOptionFile(sharedOptions, stats) };
+        jobRun->mArgs.insert(jobRun->mArgs.end(), runArgs.begin(), runArgs.end());
+    } else {
+        jobRun->mPfFileName = prepareRun(jobRun->mOptions, jobRun->mTmpCheckpoint, checkpoint, output,
+                                         createOutDb, false, &dbPaths, databases);
+        jobRun->mArgs = { "dummy", "pf=" + pf.string() };
+        error_code ec;
+        auto pfSize = filesystem::file_size(jobRun->mPfFileName, ec);
+        if (!ec) stats.optionFileBytes = pfSize;
+        ++stats.scratchFiles;
+        if (!mSourceHash.empty())
+            splitOptions(readFile(jobRun->mPfFileName), runArgs, sharedOptions);
+    }
+    stats.prepareTime = chrono::steady_clock::now() - prepareStart;
+    error_code ec;
+    for (const string &dbPath : dbPaths) {
+        auto size = filesystem::file_size(dbPath, ec);
+        if (!ec) stats.inputBytes += size;
+    }
+    stats.scratchFiles += static_cast<int>(dbPaths.size());
+
+    if (checkpoint)
+        jobRun->mCheckpoint = *checkpoint;
+    jobRun->mCreateOutDb = createOutDb;
+    jobRun->mOutput = output;
+    jobRun->mTimeLimit = timeLimit;
+
+    if (!mSourceHash.empty()) {
+        // the command line overrides the parameter file
+        auto compileStart = chrono::steady_clock::now();
+        bool compiled = false;
+        string workFile = compiledWorkFile(jobRun->mArgs, sharedOptions, compiled);
+        stats.compileTime = chrono::steady_clock::now() - compileStart;
+        if (compiled)
+            ++stats.scratchFiles;
+        if (!workFile.empty()) {
+            stats.compileCacheHit = !compiled;
+            jobRun->mArgs.push_back("action=E");
+            jobRun->mArgs.push_back("restart=" + workFile);
+        }
+    }
+    jobRun->mCreated = chrono::steady_clock::now();
+    return jobRun;
+}
+
+string GAMSJobImpl::sharedOptionFile(const string &sharedOptions, GAMSJobStats &stats)
+{
+    GAMSPath sharedFile(mWs.workingDirectory(), mWs.scratchFilePrefix() + "pf_" +
+                        GAMSPlatform::contentHash(sharedOptions) + ".pf");
+    stats.optionFileBytes = sharedOptions.size();
+    if (sharedFile.exists()) {
+        stats.optionFileCacheHit = true;
+        return sharedFile.toStdString();
+    }
+    // written under a private name, so concurrent runs never read a partial file
+    GAMSPath tmpFile(mWs.workingDirectory(), mWs.scratchFilePrefix() + "pf_" + mJobName + ".pf");
+    {
+        ofstream pf(tmpFile.toStdString(), ios::trunc);
+        pf << sharedOptions;
+    }
+    tmpFile.rename(sharedFile.toStdString());
+    mWs.mImpl->addCacheFile(sharedFile.toStdString());
+    ++stats.scratchFiles;
+    return sharedFile.toStdString();
+}
+
+string GAMSJobImpl::compiledWorkFile(const vector<string> &args, const string &sharedOptions, bool &compiled)
 {
-    GAMSOptions tmpOpt(mWs, gamsOpt);
-    GAMSCheckpoint tmpCP;
-    string pfFileName = prepareRun(tmpOpt, tmpCP, checkpoint, output, createOutDb, false, {}, databases);
+    string key = mSourceHash + '\n' + mWs.version() + '\n' + mWs.systemDirectory() + '\n';
+    if (mCheckpointStart) {
+        error_code ec;
+        auto modified = filesystem::last_write_time(mCheckpointStart->fileName(), ec);
+        key += mCheckpointStart->fileName() + '\n' + to_string(modified.time_since_epoch().count()) + '\n';
+    }
+    key += sharedOptions;
 
+    GAMSPath workFile(mWs.workingDirectory(), mWs.scratchFilePrefix() + "cc_" + GAMSPlatform::contentHash(key) + ".g00");
+    if (workFile.exists())
+        return workFile.toStdString();
+
+    // compiled under a private name, so concurrent runs never restart from a partial work file
+    GAMSPath tmpFile(mWs.workingDirectory(), mWs.scratchFilePrefix() + "cc_" + mJobName + ".g00");
     filesystem::path gamsExe = filesystem::path(mWs.systemDirectory());
     gamsExe.append(string("gams") + cExeSuffix);
+    vector<string> compileArgs;
+    for (const string &arg : args) {
+        if (arg.rfind("save=", 0) != 0 && arg.rfind("s=", 0) != 0)
+            compileArgs.push_back(arg);
+    }
+    compileArgs.push_back("action=C");
+    compileArgs.push_back("save=" + tmpFile.toStdString());
+    GAMSProcess process(gamsExe.string(), compileArgs);
+    try {
+        process.start();
+    } catch (GAMSException &) {
+        // the regular run reports the error starting GAMS
+        return "";
+    }
+    if (process.wait() != 0 || !tmpFile.exists()) {
+        // the regular run reports the compilation error
+        filesystem::remove(tmpFile);
+        return "";
+    }
+    tmpFile.rename(workFile.toStdString());
+    mWs.mImpl->addCacheFile(workFile.toStdString());
+    compiled = true;
+    return workFile.toStdString();
+}
 
-    string args = "dummy pf=";
-    GAMSPath pf(mWs.workingDirectory(), mJobName + ".pf");
-    args.append(pf.string());
+void GAMSJobImpl::launchRun(const shared_ptr<GAMSJobRun> &jobRun)
+{
+    filesystem::path gamsExe = filesystem::path(mWs.systemDirectory());
+    gamsExe.append(string("gams") + cExeSuffix);
+
+    auto process = make_shared<GAMSProcess>(gamsExe.string(), jobRun->mArgs);
+    bool started = false;
+    {
+        lock_guard<mutex> lck(jobRun->mLock);
+        if (jobRun->mDone || jobRun->mCancelled)
+            return;
+        try {
+            auto spawnStart = chrono::steady_clock::now();
+            jobRun->mStats.queueTime = spawnStart - jobRun->mCreated;
+            process->start();
+            jobRun->mStarted = chrono::steady_clock::now();
+            jobRun->mStats.spawnTime = jobRun->mStarted - spawnStart;
+            jobRun->mProcess = process;
+            started = true;
+        } catch (...) {
+            jobRun->mError = current_exception();
+        }
+    }
+    if (!started) {
+        jobRun->complete(-1, false);
+        return;
+    }
+    {
+        lock_guard<mutex> lck(mProcessLock);
+        mProcess = process;
+    }
+
+    // the log is forwarded while GAMS is running instead of collecting it until the process ends
+    GAMSProcessReaper::instance().watch(process,
+        [this, jobRun](const char *data, size_t size) { forwardOutput(*jobRun, data, size); },
+        [this, jobRun](int exitCode, bool stopped) {
+            jobRun->mStats.executionTime = chrono::steady_clock::now() - jobRun->mStarted;
+            if (jobRun->mMaxLogLines > 0 && !jobRun->mPendingLine.empty())
+                bufferLogLine(*jobRun);
+            else if (jobRun->mOutput && !jobRun->mPendingLine.empty())
+                MSG << jobRun->mPendingLine;
+            jobRun->complete(exitCode, stopped);
+        }, jobRun->mTimeLimit,
+        [jobRun]() {
+            if (jobRun->mMaxLogLines == 0)
+                return true;
+            lock_guard<mutex> lck(jobRun->mLock);
+            return jobRun->mLogLines.size() < jobRun->mMaxLogLines;
+        });
+
+    // a cancel that raced with the start could not reach the reaper yet
+    bool cancelled;
+    {
+        lock_guard<mutex> lck(jobRun->mLock);
+        cancelled = jobRun->mCancelled;
+    }
+    if (cancelled)
+        GAMSProcessReaper::instance().stop(process);
+}
+
+void GAMSJobImpl::forwardOutput(GAMSJobRun &jobRun, const char *data, size_t size)
+{
+    jobRun.mStats.logBytes += size;
+    if (jobRun.mMaxLogLines > 0) {
+        // a log without line breaks must not grow the pending line without limit
+        static const size_t cMaxLineLength = 65536;
+        size_t start = 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] != '\n')
+                continue;
+            jobRun.mPendingLine.append(data + start, i - start);
+            bufferLogLine(jobRun);
+            start = i + 1;
+        }
+        jobRun.mPendingLine.append(data + start, size - start);
+        if (jobRun.mPendingLine.size() >= cMaxLineLength)
+            bufferLogLine(jobRun);
+        return;
+    }
+    if (!jobRun.mOutput)
+        return;
+    if (mWs.debug() >= GAMSEnum::DebugLevel::ShowLog) {
+        jobRun.mPendingLine.append(data, size);
+        size_t pos;
+        while ((pos = jobRun.mPendingLine.find('\n')) != string::npos) {
+            MSG << jobRun.mPendingLine.substr(0, pos);
+            jobRun.mPendingLine.erase(0, pos + 1);
+        }
+    } else {
+        jobRun.mOutput->write(data, static_cast<streamsize>(size));
+        jobRun.mOutput->flush();
+    }
+}
 
-    string result;
-    int exitCode = runProcess(gamsExe.string(), args, result);
+void GAMSJobImpl::bufferLogLine(GAMSJobRun &jobRun)
+{
+    string &line = jobRun.mPendingLine;
+    if (!line.empty() && line.back() == '\r')
+        line.pop_back();
+    {
+        lock_guard<mutex> lck(jobRun.mLock);
+        jobRun.mLogLines.push_back(std::move(line));
+    }
+    line.clear();
+    jobRun.mFinished.notify_all();
+}
 
-    if (createOutDb) {
+void GAMSJobImpl::run(GAMSOptions *gamsOpt, const function<void(const string&)> &onLogLine,
+                      size_t maxBufferedLines)
+{
+    shared_ptr<GAMSJobRun> jobRun = createRun(gamsOpt, nullptr, nullptr, true, {}, chrono::milliseconds::zero());
+    // the command line overrides the parameter file, the log has to go to the pipe
+    if (jobRun->mOptions.logOption() == 0)
+        jobRun->mArgs.push_back("logoption=3");
+    jobRun->mMaxLogLines = max<size_t>(maxBufferedLines, 1);
+    launchRun(jobRun);
+
+    exception_ptr handlerError;
+    bool done = false;
+    while (!done) {
+        deque<string> lines;
+        {
+            unique_lock<mutex> lck(jobRun->mLock);
+            jobRun->mFinished.wait(lck, [&jobRun] { return jobRun->mDone || !jobRun->mLogLines.empty(); });
+            lines.swap(jobRun->mLogLines);
+            // all lines are buffered before the run completes
+            done = jobRun->mDone;
+        }
+        GAMSProcessReaper::instance().outputConsumed();
+        for (const string &line : lines) {
+            if (handlerError)
+                break;
+            try {
+                onLogLine(line);
+            } catch (...) {
+                handlerError = current_exception();
+                shared_ptr<GAMSProcess> process;
+                {
+                    lock_guard<mutex> lck(jobRun->mLock);
+                    jobRun->mCancelled = true;
+                    process = jobRun->mProcess;
+                }
+                if (process)
+                    GAMSProcessReaper::instance().stop(process);
+            }
+        }
+    }
+    if (handlerError) {
+        try {
+            finishRun(*jobRun);
+        } catch (GAMSException &) {
+            // the run has been stopped because of the callback
+        }
+        rethrow_exception(handlerError);
+    }
+    finishRun(*jobRun);
+}
+
+void GAMSJobImpl::addScratchFiles(GAMSJobRun &jobRun, bool failed)
+{
+    if (mWs.debug() >= GAMSEnum::DebugLevel::KeepFiles ||
+            (failed && mWs.debug() >= GAMSEnum::DebugLevel::KeepFilesOnError))
+        return;
+    GAMSOptions &tmpOpt = jobRun.mOptions;
+    GAMSPath workingDir(mWs.workingDirectory());
+    vector<string> files;
+    if (mScratchSource)
+        files.push_back(mFileName);
+    // the log and listing file are only scratch files if their names have been chosen by prepareRun
+    GAMSPath logFile = (workingDir / mJobName).suffix(".log");
+    if (GAMSPath(tmpOpt.logFile()) == logFile)
+        files.push_back(logFile.toStdString());
+    if (tmpOpt.output().empty())
+        files.push_back((workingDir / GAMSPath(mFileName).stem().string()).suffix(".lst").toStdString());
+    else
+        files.push_back((workingDir / tmpOpt.output()).toStdString());
+    if (!jobRun.mPfFileName.empty())
+        files.push_back(jobRun.mPfFileName);
+    if (jobRun.mScratchOutDb) {
+        GAMSPath gdxPath(tmpOpt.gdx());
+        if (!gdxPath.is_absolute())
+            gdxPath = workingDir / gdxPath;
+        gdxPath.setSuffix(".gdx");
+        files.push_back(gdxPath.toStdString());
+    }
+    mWs.mImpl->scratchCleaner().add(weak_from_this(), files);
+}
+
+void GAMSJobImpl::finishRun(GAMSJobRun &jobRun)
+{
+    {
+        lock_guard<mutex> lck(mProcessLock);
+        if (mProcess == jobRun.mProcess)
+            mProcess.reset();
+        mRunActive = false;
+    }
+    int exitCode = jobRun.mExitCode;
+    jobRun.mStats.exitCode = exitCode;
+    addScratchFiles(jobRun, jobRun.mStopped || exitCode != 0);
+    jobRun.mDatabases.clear();
+    if (jobRun.mError) {
+        recordStats(jobRun.mStats);
+        rethrow_exception(jobRun.mError);
+    }
+    if (jobRun.mStopped) {
+        recordStats(jobRun.mStats);
+        if (jobRun.mCancelled)
+            throw GAMSExceptionExecution("GAMS job " + mJobName + " has been cancelled", exitCode, &mWs);
+        throw GAMSExceptionTimeout("GAMS job " + mJobName + " exceeded its time limit of " +
+                                   to_string(jobRun.mTimeLimit.count()) + "ms and has been stopped", exitCode, &mWs);
+    }
+
+    GAMSOptions &tmpOpt = jobRun.mOptions;
+    if (jobRun.mCreateOutDb) {
         GAMSPath gdxPath(tmpOpt.gdx());
         if (!gdxPath.is_absolute())
             gdxPath = GAMSPath(mWs.workingDirectory()) / gdxPath;
 
         gdxPath.setSuffix(".gdx");
-        if (gdxPath.exists())
-            mOutDb = mWs.addDatabaseFromGDXForcedName(gdxPath.toStdString(), gdxPath.suffix("").filename().string(), "");
+        if (gdxPath.exists()) {
+            setOutDbFile(gdxPath.toStdString());
+            error_code ec;
+            auto size = filesystem::file_size(gdxPath, ec);
+            if (!ec) jobRun.mStats.outDBBytes = size;
+        }
     }
+    recordStats(jobRun.mStats);
 
-    if (output && mWs.debug() >= GAMSEnum::DebugLevel::ShowLog)
-        MSG << result;
-    else if (output)
-        *output << result;
     if (exitCode != 0) {
         cerr << "GAMS Error code: " << exitCode << '\n';
-        cerr << "  with args: " << args << '\n';
+        cerr << "  with args: " << jobRun.mArgs[0] << " " << jobRun.mArgs[1] << '\n';
         cerr << "  in " << mWs.workingDirectory() << '\n';
         if ((mWs.debug() < GAMSEnum::DebugLevel::KeepFilesOnError) && mWs.usingTmpWorkingDir())
             throw GAMSExceptionExecution("GAMS return code not 0 (" + to_string(exitCode) +
@@ -195,19 +686,34 @@ void GAMSJobImpl::run(GAMSOptions *gamsOpt, const GAMSCheckpoint *checkpoint,
                                          (GAMSPath(mWs.workingDirectory()) / tmpOpt.output()).toStdString() +
                                          " for more details", exitCode, &mWs);
     }
-    if (tmpCP.isValid()) {
-        GAMSPath implFile(checkpoint->fileName());
+    if (jobRun.mTmpCheckpoint.isValid()) {
+        GAMSPath implFile(jobRun.mCheckpoint.fileName());
         if (implFile.exists())
             implFile.remove();
 
-        implFile = tmpCP.fileName();
-        implFile.rename(checkpoint->fileName());
+        implFile = jobRun.mTmpCheckpoint.fileName();
+        implFile.rename(jobRun.mCheckpoint.fileName());
     }
-    if (mWs.debug() < GAMSEnum::DebugLevel::KeepFiles) {
-        filesystem::remove(pfFileName);
+    if (mWs.debug() < GAMSEnum::DebugLevel::KeepFiles && !jobRun.mPfFileName.empty()) {
+        filesystem::remove(jobRun.mPfFileName);
     }
 }
 
+void GAMSJobImpl::recordStats(const GAMSJobStats &stats)
+{
+    {
+        lock_guard<mutex> lck(mStatsLock);
+        mLastRunStats = stats;
+    }
+    mWs.mImpl->recordJobStats(stats);
+}
+
+GAMSJobStats GAMSJobImpl::lastRunStats()
+{
+    lock_guard<mutex> lck(mStatsLock);
+    return mLastRunStats;
+}
+
 void GAMSJobImpl::zip(const string &zipName, const set<string> &files)
 {
     cout << "zipping: " << zipName << '\n';
@@ -440,7 +946,7 @@ void GAMSJobImpl::runEngine(const GAMSEngineConfiguration &engineConfiguration,
         if (!gdxPath.is_absolute())
             gdxPath = filesystem::path(mWs.workingDirectory()).append(tmpOpt.gdx());
         if (filesystem::exists(gdxPath)) {
-            mOutDb = mWs.addDatabaseFromGDXForcedName(gdxPath.string(), gdxPath.filename().stem().string());
+            setOutDbFile(gdxPath.string());
         }
     }
 
@@ -490,44 +996,12 @@ bool GAMSJobImpl::interrupt()
         return true;
     }
 
-    /*qint64*/ int pid = 0 /*mProc.processId()*/; // TODO(RG): we need std process handling here
-    if(pid == 0)
-        return false;
-    return GAMSPlatform::interrupt(pid);
-}
-
-int GAMSJobImpl::runProcess(const string &what, const string &args, string& output)
-{
-    ostringstream ssp;
-    string result;
-    FILE* out;
-
-#ifdef _WIN32
-    filesystem::path p = filesystem::current_path();
-
-    ssp << "\"" << what << "\" " << args ;
-    out = _popen(ssp.str().c_str(), "rt");
-#else
-    ssp << "\"" << what << "\" " << args;
-    out = popen(ssp.str().c_str(), "r");
-#endif
-    if (!out) {
-        std::cerr << "Couldn't start command: " << ssp.str() << '\n';
-        return -1;
+    shared_ptr<GAMSProcess> process;
+    {
+        lock_guard<mutex> lck(mProcessLock);
+        process = mProcess;
     }
-    std::array<char, 128> buffer;
-    while (fgets(buffer.data(), 128, out))
-        result += buffer.data();
-
-    output = result;
-
-    int exitCode;
-#ifdef _WIN32
-    exitCode = _pclose(out);
-#else
-    exitCode = pclose(out);
-#endif
-    return exitCode;
+    return process && process->interrupt();
 }
 
 }
@@ -31,16 +31,26 @@
 #include <set>
 #include <unordered_map>
 #include <string>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <deque>
+#include <memory>
+#include <exception>
 #include "gamsenginejob.h"
 #include "gamsworkspace.h"
 #include "gamsdatabase.h"
 #include "gamsoptions.h"
+#include "gamscheckpoint.h"
+#include "gamsjobstats.h"
 
 #include <iostream>
 
 namespace gams
 {
 class GAMSCheckpoint;
+class GAMSProcess;
 
 struct inexFile
 {
@@ -67,7 +77,51 @@ struct inexFile
     }
 };
 
-class GAMSJobImpl
+/// State of one local GAMS run, shared between the caller and the GAMSProcessReaper
+struct GAMSJobRun
+{
+    GAMSJobRun(GAMSWorkspace &ws, GAMSOptions *gamsOpt) : mOptions(ws, gamsOpt) {}
+
+    GAMSOptions mOptions;
+    GAMSCheckpoint mTmpCheckpoint;
+    GAMSCheckpoint mCheckpoint;
+    std::string mPfFileName;
+    std::vector<std::string> mArgs;
+    bool mCreateOutDb = true;
+    /// The name of the out database was generated, so the GDX file is a scratch file
+    bool mScratchOutDb = false;
+    std::ostream* mOutput = nullptr;
+    /// Input databases of the run. The scratch cleaner removes an exported GDX file once its database
+    /// is gone, so they are kept until GAMS has finished reading them.
+    std::vector<GAMSDatabase> mDatabases;
+    std::string mPendingLine;
+    /// Complete log lines not yet passed to the log line callback, guarded by mLock
+    std::deque<std::string> mLogLines;
+    /// Number of buffered log lines at which reading the log is paused (zero: no log line callback);
+    /// checked before each read, so one read may exceed it
+    std::size_t mMaxLogLines = 0;
+    GAMSJobStats mStats;
+    std::chrono::steady_clock::time_point mCreated;
+    std::chrono::steady_clock::time_point mStarted;
+    std::chrono::milliseconds mTimeLimit = std::chrono::milliseconds::zero();
+    std::shared_ptr<GAMSProcess> mProcess;
+    /// Called once after the run has completed, from the thread completing it
+    std::function<void()> mOnDone;
+
+    std::mutex mLock;
+    std::condition_variable mFinished;
+    bool mDone = false;
+    bool mStopped = false;
+    bool mCancelled = false;
+    int mExitCode = -1;
+    /// Error starting GAMS, rethrown by GAMSJobImpl::finishRun
+    std::exception_ptr mError;
+
+    /// Mark the run as done, wake up all waiting threads and call mOnDone; only the first call counts
+    void complete(int exitCode, bool stopped);
+};
+
+class GAMSJobImpl : public std::enable_shared_from_this<GAMSJobImpl>
 {
 public:
 
@@ -105,7 +159,12 @@ public:
 
     void run(GAMSOptions* gamsOpt = nullptr, const GAMSCheckpoint* checkpoint = nullptr,
              std::ostream* output = nullptr, bool createOutDb = true,
-             const std::vector<GAMSDatabase> &databases = {} );
+             const std::vector<GAMSDatabase> &databases = {},
+             std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero());
+
+    /// Run locally and pass the log line by line to a callback called from the calling thread
+    void run(GAMSOptions* gamsOpt, const std::function<void(const std::string&)> &onLogLine,
+             std::size_t maxBufferedLines);
 
     void runEngine(const GAMSEngineConfiguration &engineConfiguration, GAMSOptions* gamsOptions,
                    GAMSCheckpoint *checkpoint, std::ostream *output,
@@ -113,21 +172,76 @@ public:
                    const std::unordered_map<std::string, std::string> &engineOptions,
                    bool createOutDB,  bool removeResults);
 
+    /// Prepare a local run (option file, input databases) without starting GAMS
+    /// \remark Throws if the previous run of the job has not been finished by finishRun yet.
+    std::shared_ptr<GAMSJobRun> createRun(GAMSOptions* gamsOpt, const GAMSCheckpoint* checkpoint,
+                                          std::ostream* output, bool createOutDb,
+                                          const std::vector<GAMSDatabase> &databases,
+                                          std::chrono::milliseconds timeLimit);
+    std::shared_ptr<GAMSJobRun> prepareJobRun(GAMSOptions* gamsOpt, const GAMSCheckpoint* checkpoint,
+                                              std::ostream* output, bool createOutDb,
+                                              const std::vector<GAMSDatabase> &databases,
+                                              std::chrono::milliseconds timeLimit);
+
+    /// Start GAMS for a prepared run, unless the run has been cancelled in the meantime
+    void launchRun(const std::shared_ptr<GAMSJobRun> &jobRun);
+
+    /// Prepare and start a local run without waiting for it to finish
+    std::shared_ptr<GAMSJobRun> startRun(GAMSOptions* gamsOpt, const GAMSCheckpoint* checkpoint,
+                                         std::ostream* output, bool createOutDb,
+                                         const std::vector<GAMSDatabase> &databases,
+                                         std::chrono::milliseconds timeLimit);
+
+    /// Evaluate a finished run: load the out database, move the checkpoint and clean up
+    void finishRun(GAMSJobRun &jobRun);
+
     GAMSDatabase outDB();
 
+    GAMSJobStats lastRunStats();
+
     bool interrupt();
     LogId logID() { return mWs.logID(); }
 
 public:
     GAMSWorkspace mWs;
     std::string mJobName;
+    /// Hash of the model source if the job uses the compile cache of the workspace
+    std::string mSourceHash;
+    /// The source file has been written by the workspace and is a scratch file of the job
+    bool mScratchSource = false;
+
+    /// Serializes options as written to an option file. GAMSOptions can only write files, on Linux
+    /// the file is kept in memory, elsewhere a temporary file is written and removed again.
+    static std::string optionFileText(GAMSOptions &options, const std::string &tmpFileName);
 
     void zip(const std::string &zipName, const std::set<std::string> &files);
     void unzip(const std::string &zipName, const std::string &destination = nullptr);
 
 private:
-    int runProcess(const std::string &what, const std::string &args, std::string &output);
+    /// Get the work file of the compiled model source, compile it if it is not cached yet
+    /// \returns The work file or an empty string if the source could not be compiled
+    std::string compiledWorkFile(const std::vector<std::string> &args, const std::string &sharedOptions, bool &compiled);
+
+    /// Get the option file shared by all runs with the same options, it is only written if no run
+    /// has written it before
+    std::string sharedOptionFile(const std::string &sharedOptions, GAMSJobStats &stats);
+
+    void forwardOutput(GAMSJobRun &jobRun, const char *data, std::size_t size);
+    /// Move the pending log line to the buffered log lines of a run with a log line callback
+    void bufferLogLine(GAMSJobRun &jobRun);
+    void recordStats(const GAMSJobStats &stats);
+    /// Pass the scratch files of a finished run to the scratch cleaner of the workspace
+    void addScratchFiles(GAMSJobRun &jobRun, bool failed);
+    void setOutDbFile(const std::string &gdxFile);
+
+    /// Set the options of a run and export its databases
+    void prepareOptions(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
+                        const GAMSCheckpoint* checkpoint, std::ostream* output, bool createOutDb,
+                        bool relativePaths, std::set<std::string> *dbPaths,
+                        const std::vector<GAMSDatabase> &databases);
 
+    /// Set the options of a run, export its databases and write the option file of the job
+    /// \returns The option file
     std::string prepareRun(GAMSOptions& tmpOptions, GAMSCheckpoint& tmpCP,
                            const GAMSCheckpoint* checkpoint = nullptr, std::ostream* output = nullptr,
                            bool createOutDb = true, bool relativePaths = false,
@@ -135,9 +249,18 @@ private:
                            const std::vector<GAMSDatabase> &databases = {});
 
     GAMSDatabase mOutDb;
+    /// Result GDX file not loaded into mOutDb yet
+    std::string mOutDbFile;
+    std::mutex mOutDbLock;
     std::string mFileName;
     GAMSEngineJob* mEngineJob = nullptr;
     GAMSCheckpoint* mCheckpointStart = nullptr;
+    std::shared_ptr<GAMSProcess> mProcess;
+    /// A run has been created and not finished yet, guarded by mProcessLock
+    bool mRunActive = false;
+    std::mutex mProcessLock;
+    GAMSJobStats mLastRunStats;
+    std::mutex mStatsLock;
 };
 }
 #endif // GAMSJOBIMPL_H
@@ -0,0 +1,170 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsjobscheduler.h"
+#include "gamsjobschedulerimpl.h"
+#include "gamsjobhandleimpl.h"
+#include "gamsjobimpl.h"
+#include "gamsjob.h"
+#include "gamscheckpoint.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+static chrono::milliseconds toMilliseconds(chrono::steady_clock::duration duration)
+{
+    return chrono::duration_cast<chrono::milliseconds>(duration);
+}
+
+GAMSJobScheduler::GAMSJobScheduler(int maxJobs)
+    : mImpl(make_shared<GAMSJobSchedulerImpl>(maxJobs))
+{}
+
+GAMSJobScheduler::~GAMSJobScheduler()
+{}
+
+int GAMSJobScheduler::maxJobs() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    return mImpl->mMaxJobs;
+}
+
+void GAMSJobScheduler::setMaxJobs(int maxJobs)
+{
+    mImpl->setMaxJobs(maxJobs);
+}
+
+double GAMSJobScheduler::resourceLimit(const string &resource) const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    auto it = mImpl->mLimits.find(resource);
+    return (it == mImpl->mLimits.end()) ? 0.0 : it->second;
+}
+
+void GAMSJobScheduler::setResourceLimit(const string &resource, double capacity)
+{
+    mImpl->setResourceLimit(resource, capacity);
+}
+
+GAMSJobHandle GAMSJobScheduler::submit(GAMSJob &job, int priority, const map<string, double> &resources)
+{
+    if (!job.mImpl) throw GAMSException("GAMSJobScheduler: The job has not been initialized.");
+    auto jobRun = job.mImpl->createRun(nullptr, nullptr, nullptr, true, {}, chrono::milliseconds::zero());
+    mImpl->submit(job.mImpl, jobRun, priority, resources);
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(job.mImpl, jobRun));
+}
+
+GAMSJobHandle GAMSJobScheduler::submit(GAMSJob &job, GAMSOptions &gamsOptions, int priority,
+                                       const map<string, double> &resources)
+{
+    if (!job.mImpl) throw GAMSException("GAMSJobScheduler: The job has not been initialized.");
+    auto jobRun = job.mImpl->createRun(&gamsOptions, nullptr, nullptr, true, {}, chrono::milliseconds::zero());
+    mImpl->submit(job.mImpl, jobRun, priority, resources);
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(job.mImpl, jobRun));
+}
+
+GAMSJobHandle GAMSJobScheduler::submit(GAMSJob &job, GAMSOptions &gamsOptions, const GAMSCheckpoint &gamsCheckpoint,
+                                       ostream *output, bool createOutDB, const vector<GAMSDatabase> &databases,
+                                       chrono::milliseconds timeLimit, int priority,
+                                       const map<string, double> &resources)
+{
+    if (!job.mImpl) throw GAMSException("GAMSJobScheduler: The job has not been initialized.");
+    auto jobRun = job.mImpl->createRun(&gamsOptions, (gamsCheckpoint.isValid() ? &gamsCheckpoint : nullptr),
+                                       output, createOutDB, databases, timeLimit);
+    mImpl->submit(job.mImpl, jobRun, priority, resources);
+    return GAMSJobHandle(make_shared<GAMSJobHandleImpl>(job.mImpl, jobRun));
+}
+
+void GAMSJobScheduler::waitForAll()
+{
+    mImpl->waitForAll();
+}
+
+int GAMSJobScheduler::queueDepth() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    return static_cast<int>(mImpl->mQueue.size());
+}
+
+int GAMSJobScheduler::runningJobs() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    return mImpl->mRunning;
+}
+
+int GAMSJobScheduler::finishedJobs() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    return mImpl->mFinished;
+}
+
+chrono::milliseconds GAMSJobScheduler::averageWaitTime() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    int count = 0;
+    chrono::steady_clock::duration total = chrono::steady_clock::duration::zero();
+    for (const auto &stats : mImpl->mWaitStats) {
+        count += stats.second.mCount;
+        total += stats.second.mTotal;
+    }
+    return count ? toMilliseconds(total / count) : chrono::milliseconds::zero();
+}
+
+chrono::milliseconds GAMSJobScheduler::averageWaitTime(int priority) const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    auto it = mImpl->mWaitStats.find(priority);
+    if (it == mImpl->mWaitStats.end() || !it->second.mCount)
+        return chrono::milliseconds::zero();
+    return toMilliseconds(it->second.mTotal / it->second.mCount);
+}
+
+chrono::milliseconds GAMSJobScheduler::maxWaitTime() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    chrono::steady_clock::duration res = chrono::steady_clock::duration::zero();
+    for (const auto &stats : mImpl->mWaitStats)
+        res = max(res, stats.second.mMax);
+    return toMilliseconds(res);
+}
+
+chrono::milliseconds GAMSJobScheduler::maxWaitTime(int priority) const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    auto it = mImpl->mWaitStats.find(priority);
+    return (it == mImpl->mWaitStats.end()) ? chrono::milliseconds::zero() : toMilliseconds(it->second.mMax);
+}
+
+chrono::milliseconds GAMSJobScheduler::averageRunTime() const
+{
+    lock_guard<mutex> lck(mImpl->mLock);
+    if (!mImpl->mFinished)
+        return chrono::milliseconds::zero();
+    return toMilliseconds(mImpl->mTotalRunTime / mImpl->mFinished);
+}
+
+} // namespace gams
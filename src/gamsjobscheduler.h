@@ -0,0 +1,149 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSJOBSCHEDULER_H
+#define GAMSJOBSCHEDULER_H
+
+#include "gamslib_global.h"
+#include <string>
+#include <memory>
+#include <vector>
+#include <map>
+#include <chrono>
+#include "gamsjobhandle.h"
+
+namespace gams {
+
+class GAMSJob;
+class GAMSOptions;
+class GAMSCheckpoint;
+class GAMSDatabase;
+class GAMSJobSchedulerImpl;
+
+/// <p>The GAMSJobScheduler runs submitted GAMSJobs asynchronously while keeping the number of
+/// concurrently running GAMS processes within configurable limits. Besides the number of jobs,
+/// arbitrary named resources (e.g. "memory" or "licenses") can be limited. Each submitted job
+/// declares how much of these resources it uses.</p>
+/// <p>Jobs are started in order of their priority and, for equal priorities, in order of
+/// submission. A queued job is never overtaken by a job of lower priority, so high-priority
+/// jobs get the next free capacity even when many large batch jobs are waiting.</p>
+/// <p>The GAMS processes are supervised by the same library thread as GAMSJob::runAsync, so
+/// the scheduler does not need a thread per job.</p>
+class LIBSPEC GAMSJobScheduler
+{
+public:
+    /// Constructor.
+    /// \param maxJobs Maximum number of GAMS processes running at the same time
+    ///                (number of hardware threads if not positive).
+    GAMSJobScheduler(int maxJobs = 0);
+
+    /// Destructor. Already submitted jobs are still run.
+    ~GAMSJobScheduler();
+
+    /// Get the maximum number of GAMS processes running at the same time.
+    int maxJobs() const;
+
+    /// Set the maximum number of GAMS processes running at the same time.
+    /// \param maxJobs Maximum number of jobs (number of hardware threads if not positive).
+    void setMaxJobs(int maxJobs);
+
+    /// Get the capacity of a resource.
+    /// \param resource Name of the resource.
+    /// \return Returns the capacity or <c>0</c> if the resource is not limited.
+    double resourceLimit(const std::string &resource) const;
+
+    /// Limit a resource that is shared by all jobs of the scheduler.
+    /// \param resource Name of the resource.
+    /// \param capacity Capacity of the resource (not limited if not positive).
+    void setResourceLimit(const std::string &resource, double capacity);
+
+    /// Submit a GAMSJob.
+    /// \param job GAMSJob to run.
+    /// \param priority Jobs with a higher priority are started first.
+    /// \param resources Amount of each limited resource used by the job while it runs.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle submit(GAMSJob &job, int priority = 0, const std::map<std::string, double> &resources = {});
+
+    /// Submit a GAMSJob.
+    /// \param job GAMSJob to run.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param priority Jobs with a higher priority are started first.
+    /// \param resources Amount of each limited resource used by the job while it runs.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle submit(GAMSJob &job, GAMSOptions &gamsOptions, int priority = 0,
+                         const std::map<std::string, double> &resources = {});
+
+    /// Submit a GAMSJob.
+    /// \param job GAMSJob to run.
+    /// \param gamsOptions GAMSOptions to control the GAMSJob.
+    /// \param gamsCheckpoint GAMSCheckpoint to be created by GAMSJob.
+    /// \param output Stream to capture GAMS log, written from a library thread while GAMS is running.
+    /// \param createOutDB Flag that activates writing to outDB.
+    /// \param databases GAMSDatabases read by the GAMSJob, exported when the job is submitted.
+    /// \param timeLimit Maximum wall-clock time of the GAMS run once started (zero for no limit).
+    /// \param priority Jobs with a higher priority are started first.
+    /// \param resources Amount of each limited resource used by the job while it runs.
+    /// \return Returns a GAMSJobHandle to wait for, cancel or query the run.
+    GAMSJobHandle submit(GAMSJob &job, GAMSOptions &gamsOptions, const GAMSCheckpoint &gamsCheckpoint,
+                         std::ostream* output, bool createOutDB, const std::vector<gams::GAMSDatabase> &databases,
+                         std::chrono::milliseconds timeLimit, int priority = 0,
+                         const std::map<std::string, double> &resources = {});
+
+    /// Block until all submitted jobs have finished.
+    void waitForAll();
+
+    /// Get the number of jobs waiting to be started.
+    int queueDepth() const;
+
+    /// Get the number of running jobs.
+    int runningJobs() const;
+
+    /// Get the number of jobs that have been started and have finished.
+    int finishedJobs() const;
+
+    /// Get the average time the started jobs waited in the queue.
+    std::chrono::milliseconds averageWaitTime() const;
+
+    /// Get the average time the started jobs of one priority waited in the queue.
+    /// \param priority Priority of the jobs.
+    std::chrono::milliseconds averageWaitTime(int priority) const;
+
+    /// Get the longest time a started job waited in the queue.
+    std::chrono::milliseconds maxWaitTime() const;
+
+    /// Get the longest time a started job of one priority waited in the queue.
+    /// \param priority Priority of the jobs.
+    std::chrono::milliseconds maxWaitTime(int priority) const;
+
+    /// Get the average wall-clock time of the finished jobs.
+    std::chrono::milliseconds averageRunTime() const;
+
+private:
+    std::shared_ptr<GAMSJobSchedulerImpl> mImpl;
+};
+
+} // namespace gams
+
+#endif // GAMSJOBSCHEDULER_H
@@ -0,0 +1,183 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsjobschedulerimpl.h"
+#include "gamsjobimpl.h"
+
+#include <thread>
+#include <algorithm>
+
+using namespace std;
+
+namespace gams {
+
+static int defaultMaxJobs(int maxJobs)
+{
+    if (maxJobs > 0)
+        return maxJobs;
+    return max(1, static_cast<int>(thread::hardware_concurrency()));
+}
+
+GAMSJobSchedulerImpl::GAMSJobSchedulerImpl(int maxJobs)
+    : mMaxJobs(defaultMaxJobs(maxJobs))
+{}
+
+void GAMSJobSchedulerImpl::submit(const shared_ptr<GAMSJobImpl> &job, const shared_ptr<GAMSJobRun> &jobRun,
+                                  int priority, const map<string, double> &resources)
+{
+    auto entry = make_shared<Entry>();
+    entry->mJob = job;
+    entry->mRun = jobRun;
+    entry->mPriority = priority;
+    entry->mResources = resources;
+    entry->mSubmitted = chrono::steady_clock::now();
+
+    // keeps the scheduler alive until all its jobs are done
+    auto self = shared_from_this();
+    jobRun->mOnDone = [self, entry] { self->completed(entry); };
+    {
+        lock_guard<mutex> lck(mLock);
+        // behind all jobs of the same or a higher priority
+        auto it = find_if(mQueue.begin(), mQueue.end(),
+                          [priority](const shared_ptr<Entry> &e) { return e->mPriority < priority; });
+        mQueue.insert(it, entry);
+    }
+    dispatch();
+}
+
+void GAMSJobSchedulerImpl::waitForAll()
+{
+    unique_lock<mutex> lck(mLock);
+    mIdle.wait(lck, [this] { return mQueue.empty() && mRunning == 0; });
+}
+
+void GAMSJobSchedulerImpl::setMaxJobs(int maxJobs)
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        mMaxJobs = defaultMaxJobs(maxJobs);
+    }
+    dispatch();
+}
+
+void GAMSJobSchedulerImpl::setResourceLimit(const string &resource, double capacity)
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        if (capacity > 0)
+            mLimits[resource] = capacity;
+        else
+            mLimits.erase(resource);
+    }
+    dispatch();
+}
+
+bool GAMSJobSchedulerImpl::fits(const Entry &entry) const
+{
+    // a job demanding more than a whole resource must not block the queue forever
+    if (mRunning == 0)
+        return true;
+    if (mRunning >= mMaxJobs)
+        return false;
+    for (const auto &demand : entry.mResources) {
+        auto limit = mLimits.find(demand.first);
+        if (limit == mLimits.end())
+            continue;
+        auto used = mUsed.find(demand.first);
+        double inUse = (used == mUsed.end()) ? 0.0 : used->second;
+        if (inUse + demand.second > limit->second)
+            return false;
+    }
+    return true;
+}
+
+void GAMSJobSchedulerImpl::dispatch()
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        // the running loop checks the queue again before it stops, so it picks up the change of
+        // the caller; this keeps a launch failing synchronously from recursing via completed()
+        if (mDispatching)
+            return;
+        mDispatching = true;
+    }
+    try {
+        while (true) {
+            shared_ptr<Entry> entry;
+            {
+                lock_guard<mutex> lck(mLock);
+                // strictly in queue order: a waiting job of higher priority is never overtaken
+                if (mQueue.empty() || !fits(*mQueue.front())) {
+                    mDispatching = false;
+                    return;
+                }
+                entry = mQueue.front();
+                mQueue.pop_front();
+
+                entry->mLaunched = true;
+                entry->mStarted = chrono::steady_clock::now();
+                mRunning++;
+                for (const auto &demand : entry->mResources)
+                    mUsed[demand.first] += demand.second;
+
+                WaitStats &stats = mWaitStats[entry->mPriority];
+                auto waited = entry->mStarted - entry->mSubmitted;
+                stats.mCount++;
+                stats.mTotal += waited;
+                stats.mMax = max(stats.mMax, waited);
+            }
+            // the run may complete (and release the entry) before launchRun returns
+            shared_ptr<GAMSJobImpl> job = entry->mJob;
+            shared_ptr<GAMSJobRun> jobRun = entry->mRun;
+            job->launchRun(jobRun);
+        }
+    } catch (...) {
+        lock_guard<mutex> lck(mLock);
+        mDispatching = false;
+        throw;
+    }
+}
+
+void GAMSJobSchedulerImpl::completed(const shared_ptr<Entry> &entry)
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        if (entry->mLaunched) {
+            mRunning--;
+            for (const auto &demand : entry->mResources)
+                mUsed[demand.first] -= demand.second;
+            mFinished++;
+            mTotalRunTime += chrono::steady_clock::now() - entry->mStarted;
+        } else {
+            // cancelled while waiting
+            mQueue.remove(entry);
+        }
+        if (mQueue.empty() && mRunning == 0)
+            mIdle.notify_all();
+    }
+    dispatch();
+}
+
+} // namespace gams
@@ -0,0 +1,99 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSJOBSCHEDULERIMPL_H
+#define GAMSJOBSCHEDULERIMPL_H
+
+#include <string>
+#include <memory>
+#include <map>
+#include <list>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace gams {
+
+class GAMSJobImpl;
+struct GAMSJobRun;
+
+class GAMSJobSchedulerImpl : public std::enable_shared_from_this<GAMSJobSchedulerImpl>
+{
+public:
+    /// A submitted job
+    struct Entry
+    {
+        std::shared_ptr<GAMSJobImpl> mJob;
+        std::shared_ptr<GAMSJobRun> mRun;
+        int mPriority = 0;
+        std::map<std::string, double> mResources;
+        std::chrono::steady_clock::time_point mSubmitted;
+        std::chrono::steady_clock::time_point mStarted;
+        bool mLaunched = false;
+    };
+
+    /// Wait time statistics of the jobs of one priority
+    struct WaitStats
+    {
+        int mCount = 0;
+        std::chrono::steady_clock::duration mTotal = std::chrono::steady_clock::duration::zero();
+        std::chrono::steady_clock::duration mMax = std::chrono::steady_clock::duration::zero();
+    };
+
+    GAMSJobSchedulerImpl(int maxJobs);
+
+    /// Queue a prepared run and start it as soon as the limits allow it
+    void submit(const std::shared_ptr<GAMSJobImpl> &job, const std::shared_ptr<GAMSJobRun> &jobRun,
+                int priority, const std::map<std::string, double> &resources);
+    void waitForAll();
+    void setMaxJobs(int maxJobs);
+    void setResourceLimit(const std::string &resource, double capacity);
+
+    int mMaxJobs;
+    std::map<std::string, double> mLimits;
+
+    mutable std::mutex mLock;
+    std::condition_variable mIdle;
+    /// waiting jobs, ordered by priority and submission
+    std::list<std::shared_ptr<Entry>> mQueue;
+    std::map<std::string, double> mUsed;
+    int mRunning = 0;
+    int mFinished = 0;
+    std::chrono::steady_clock::duration mTotalRunTime = std::chrono::steady_clock::duration::zero();
+    std::map<int, WaitStats> mWaitStats;
+    /// A dispatch loop is running, further calls of dispatch() leave the work to it
+    bool mDispatching = false;
+
+private:
+    /// Start queued jobs while the limits allow it; only one thread runs the loop at a time
+    void dispatch();
+    /// Release the resources of a completed or cancelled job
+    void completed(const std::shared_ptr<Entry> &entry);
+    bool fits(const Entry &entry) const;
+};
+
+} // namespace gams
+
+#endif // GAMSJOBSCHEDULERIMPL_H
@@ -0,0 +1,53 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsjobstats.h"
+#include <string>
+
+using namespace std;
+
+namespace gams {
+
+chrono::nanoseconds GAMSJobStats::time(Phase phase) const
+{
+    switch (phase) {
+    case Prepare: return prepareTime;
+    case Compile: return compileTime;
+    case Queue: return queueTime;
+    case Spawn: return spawnTime;
+    case Execution: return executionTime;
+    case OutDBLoad: return outDBLoadTime;
+    case Total: return prepareTime + compileTime + queueTime + spawnTime + executionTime + outDBLoadTime;
+    }
+    return chrono::nanoseconds::zero();
+}
+
+string GAMSJobStats::text(Phase phase)
+{
+    const char * res[] = {"Prepare","Compile","Queue","Spawn","Execution","OutDBLoad","Total"};
+    return res[phase];
+}
+
+} // namespace gams
@@ -0,0 +1,84 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSJOBSTATS_H
+#define GAMSJOBSTATS_H
+
+#include "gamslib_global.h"
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace gams {
+
+/// Timings and byte counts of the phases of one local GAMSJob run.
+struct LIBSPEC GAMSJobStats
+{
+    /// Phases of a GAMSJob run
+    enum Phase
+    {
+        Prepare = 0,    ///< Export of the input databases and writing the option file
+        Compile,        ///< Compilation into the compile cache (see GAMSWorkspace::setCompileCache)
+        Queue,          ///< Waiting in a GAMSJobScheduler
+        Spawn,          ///< Starting the GAMS process
+        Execution,      ///< Running GAMS until the process has been reaped
+        OutDBLoad,      ///< Reading the result GDX file into the out database on the first call of GAMSJob::outDB
+        Total           ///< Sum of all phases
+    };
+
+    /// Number of phases including Total
+    static const int cPhaseCount = Total + 1;
+
+    /// Get the time spent in a phase.
+    /// \param phase The phase.
+    /// \return Returns the time spent in the phase.
+    std::chrono::nanoseconds time(Phase phase) const;
+
+    /// Get the name of a phase.
+    /// \param phase The phase.
+    /// \return Returns the name of the phase.
+    static std::string text(Phase phase);
+
+    std::chrono::nanoseconds prepareTime = std::chrono::nanoseconds::zero();    ///< Time of phase Prepare
+    std::chrono::nanoseconds compileTime = std::chrono::nanoseconds::zero();    ///< Time of phase Compile
+    std::chrono::nanoseconds queueTime = std::chrono::nanoseconds::zero();      ///< Time of phase Queue
+    std::chrono::nanoseconds spawnTime = std::chrono::nanoseconds::zero();      ///< Time of phase Spawn
+    std::chrono::nanoseconds executionTime = std::chrono::nanoseconds::zero();  ///< Time of phase Execution
+    std::chrono::nanoseconds outDBLoadTime = std::chrono::nanoseconds::zero();  ///< Time of phase OutDBLoad (zero until GAMSJob::outDB has been called)
+
+    std::uint64_t inputBytes = 0;       ///< Size of the exported input database GDX files
+    std::uint64_t optionFileBytes = 0;  ///< Size of the option file
+    std::uint64_t logBytes = 0;         ///< Size of the GAMS log read from the process
+    std::uint64_t outDBBytes = 0;       ///< Size of the result GDX file
+
+    int scratchFiles = 0;               ///< Number of files written by the library for the run and left in the working directory
+    bool compileCacheHit = false;       ///< <c>true</c> if the run restarted from a cached work file
+    bool optionFileCacheHit = false;    ///< <c>true</c> if the run used a shared option file (see GAMSWorkspace::setOptionFileCache)
+    int exitCode = -1;                  ///< Exit code of the GAMS process
+};
+
+} // namespace gams
+
+#endif // GAMSJOBSTATS_H
@@ -42,8 +42,13 @@ class GAMSDatabaseImpl;
 class GAMSDatabaseDomainViolationImpl;
 class GAMSDomainImpl;
 class GAMSJobImpl;
+class GAMSJobHandleImpl;
+class GAMSJobSchedulerImpl;
 class GAMSModelInstanceImpl;
 class GAMSModelInstanceOptImpl;
+class GAMSModelInstancePoolImpl;
+class GAMSScenarioBatchImpl;
+class GAMSSolveHandleImpl;
 class GAMSModifierImpl;
 class GAMSOptionsImpl;
 class GAMSSymbolImpl;
@@ -76,8 +81,13 @@ template class LIBSPEC std::shared_ptr<gams::GAMSDatabaseImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSDatabaseDomainViolationImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSDomainImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSJobImpl>;
+template class LIBSPEC std::shared_ptr<gams::GAMSJobHandleImpl>;
+template class LIBSPEC std::shared_ptr<gams::GAMSJobSchedulerImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSModelInstanceImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSModelInstanceOptImpl>;
+template class LIBSPEC std::shared_ptr<gams::GAMSModelInstancePoolImpl>;
+template class LIBSPEC std::shared_ptr<gams::GAMSScenarioBatchImpl>;
+template class LIBSPEC std::shared_ptr<gams::GAMSSolveHandleImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSModifierImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSOptionsImpl>;
 template class LIBSPEC std::shared_ptr<gams::GAMSSymbolImpl>;
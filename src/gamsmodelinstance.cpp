@@ -25,6 +25,7 @@
 
 #include "gamsjob.h"
 #include "gamsmodelinstanceimpl.h"
+#include "gamssolvehandleimpl.h"
 
 #include <iostream>
 #include <memory>
@@ -34,6 +35,19 @@ using namespace std;
 
 namespace gams {
 
+/// Marks a model instance as solving for the duration of a synchronous solve
+class SolveGuard
+{
+public:
+    SolveGuard(GAMSModelInstanceImpl &impl) : mImpl(impl) { mImpl.startSolve(); }
+    ~SolveGuard() { mImpl.endSolve(); }
+    SolveGuard(const SolveGuard&) = delete;
+    SolveGuard &operator=(const SolveGuard&) = delete;
+
+private:
+    GAMSModelInstanceImpl &mImpl;
+};
+
 GAMSModelInstance::GAMSModelInstance(const std::shared_ptr<GAMSModelInstanceImpl>& impl) :mImpl(impl)
 {}
 
@@ -99,27 +113,97 @@ void GAMSModelInstance::solve(gams::GAMSEnum::SymbolUpdateType updateType,
                               const GAMSModelInstanceOpt &miOpt)
 {
     if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
     mImpl->solve(updateType, &output, miOpt);
 }
 
 void GAMSModelInstance::solve(const GAMSModelInstanceOpt &miOpt)
 {
     if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
     mImpl->solve(GAMSEnum::SymbolUpdateType::BaseCase, nullptr, miOpt);
 }
 
 void GAMSModelInstance::solve(std::ostream& output)
 {
     if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
     mImpl->solve(GAMSEnum::SymbolUpdateType::BaseCase, &output, GAMSModelInstanceOpt());
 }
 
 void GAMSModelInstance::solve(GAMSEnum::SymbolUpdateType updateType)
 {
     if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
     mImpl->solve(updateType, nullptr, GAMSModelInstanceOpt());
 }
 
+void GAMSModelInstance::solve(GAMSEnum::SymbolUpdateType updateType, const SolverLogHandler& logHandler,
+                              const GAMSModelInstanceOpt& miOpt, chrono::milliseconds logInterval)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
+    mImpl->solve(updateType, nullptr, miOpt, logHandler, logInterval);
+}
+
+void GAMSModelInstance::solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                                   GAMSEnum::SymbolUpdateType updateType)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
+    mImpl->solveBatch(scenarios, results, updateType, GAMSModelInstanceOpt());
+}
+
+void GAMSModelInstance::solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                                   GAMSEnum::SymbolUpdateType updateType, const GAMSModelInstanceOpt &miOpt)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    SolveGuard guard(*mImpl);
+    mImpl->solveBatch(scenarios, results, updateType, miOpt);
+}
+
+GAMSSolveHandle GAMSModelInstance::solveAsync(const GAMSModelInstanceOpt &miOpt, chrono::milliseconds timeLimit,
+                                              GAMSEnum::SymbolUpdateType updateType)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    // released by the solve handle once the solve returned
+    mImpl->startSolve();
+    try {
+        return GAMSSolveHandle(make_shared<GAMSSolveHandleImpl>(vector<GAMSModelInstance>{*this},
+                                                                vector<GAMSModelInstanceOpt>{miOpt}, updateType,
+                                                                chrono::steady_clock::now(), timeLimit, nullptr));
+    } catch (...) {
+        mImpl->endSolve();
+        throw;
+    }
+}
+
+GAMSSolveHandle GAMSModelInstance::solvePortfolio(const vector<GAMSModelInstanceOpt> &alternatives,
+                                                  chrono::milliseconds timeLimit, const Acceptance &acceptable,
+                                                  GAMSEnum::SymbolUpdateType updateType)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    if (alternatives.empty())
+        throw GAMSException("GAMSModelInstance: solvePortfolio needs at least one alternative.");
+    // the budget includes copying the model instances
+    auto start = chrono::steady_clock::now();
+    // released by the solve handle once the solves returned, the copies are taken from an idle instance
+    mImpl->startSolve();
+    vector<GAMSModelInstance> instances { *this };
+    try {
+        for (size_t i = 1; i < alternatives.size(); ++i) {
+            instances.push_back(copyModelInstance());
+            instances.back().mImpl->startSolve();
+        }
+        return GAMSSolveHandle(make_shared<GAMSSolveHandleImpl>(instances, alternatives, updateType,
+                                                                start, timeLimit, acceptable));
+    } catch (...) {
+        for (GAMSModelInstance &mi : instances)
+            mi.mImpl->endSolve();
+        throw;
+    }
+}
+
 GAMSEnum::ModelStat GAMSModelInstance::modelStatus()
 {
     if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
@@ -144,6 +228,90 @@ std::string GAMSModelInstance::solveStatusAsString()
     return mImpl->solveStatusAsString();
 }
 
+int GAMSModelInstance::lastSolveUpdatedRecords()
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->lastSolveStats().updatedRecords;
+}
+
+int GAMSModelInstance::lastSolveSkippedModifiers()
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->lastSolveStats().skippedModifiers;
+}
+
+GAMSModelInstanceStats GAMSModelInstance::lastSolveStats()
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->lastSolveStats();
+}
+
+vector<int> GAMSModelInstance::solveStatsHistogram(GAMSModelInstanceStats::Phase phase)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->solveStatsHistogram(phase);
+}
+
+void GAMSModelInstance::resetSolveStatsHistogram()
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->resetSolveStatsHistogram();
+}
+
+int GAMSModelInstance::lastSolveIterations()
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->lastSolveStats().iterations;
+}
+
+void GAMSModelInstance::saveSnapshot(const string &name)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->saveSnapshot(name);
+}
+
+void GAMSModelInstance::restoreSnapshot(const string &name)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->restoreSnapshot(name);
+}
+
+void GAMSModelInstance::swapSnapshot(const string &name)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->swapSnapshot(name);
+}
+
+bool GAMSModelInstance::hasSnapshot(const string &name)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->hasSnapshot(name);
+}
+
+void GAMSModelInstance::removeSnapshot(const string &name)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->removeSnapshot(name);
+}
+
+int GAMSModelInstance::solutionRecords(const string &symbol)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->solutionRecords(symbol);
+}
+
+vector<vector<string>> GAMSModelInstance::solutionKeys(const string &symbol)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    return mImpl->solutionKeys(symbol);
+}
+
+void GAMSModelInstance::extractSolution(const string &symbol, double *levels, double *marginals)
+{
+    if (!mImpl) throw GAMSException("GAMSModelInstance: This model instance has not been initialized.");
+    mImpl->extractSolution(symbol, levels, marginals);
+}
+
 GAMSModelInstance::GAMSModelInstance()
 {
 
@@ -29,9 +29,16 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <functional>
+#include <chrono>
 #include "gamsenum.h"
 #include "gamsmodifier.h"
 #include "gamsmodelinstanceopt.h"
+#include "gamsbatchscenarios.h"
+#include "gamsbatchresults.h"
+#include "gamssolverprogress.h"
+#include "gamsmodelinstancestats.h"
+#include "gamssolvehandle.h"
 
 namespace gams {
 
@@ -79,7 +86,9 @@ class GAMSModelInstanceImpl;
 /// original data record is restored (UpdateType=BaseCase) which is the default, 2) the
 /// default record of a GAMSParameter (which is 0)  is used (UpdateType=Zero, and 3) no
 /// copy takes place and we use the previously copied record value (UpdateType=Accumulate).
-/// After the model instance has been updated, the model is passed to the selected solver.</p>
+/// After the model instance has been updated, the model is passed to the selected solver.
+/// After the first Solve only the records of SyncDB that were modified since the last
+/// Solve are copied.</p>
 /// <p>After the completion of the Solve method, the SyncDB will contain the primal and
 /// dual solution of the model just solved. Moreover, the GAMSParameters that are
 /// GAMSModifiers are also accessible in SyncDB as GAMSVariables with the name of the
@@ -125,6 +134,14 @@ class GAMSModelInstanceImpl;
 class LIBSPEC GAMSModelInstance
 {
 public:
+    /// Handler receiving the solver log line by line while the solver is running.
+    /// \remark The handler runs on the thread calling solve. It may call interrupt() to stop the solve.
+    typedef std::function<void(const std::string& line, const GAMSSolverProgress& progress)> SolverLogHandler;
+
+    /// Check deciding if the result of a solve in solvePortfolio is acceptable.
+    /// \remark The check runs on the solver thread of the model instance passed.
+    typedef std::function<bool(GAMSModelInstance& solved)> Acceptance;
+
     /// Default constructor.
     GAMSModelInstance();
 
@@ -200,6 +217,66 @@ public:
     /// \param updateType Update type.
     void solve(GAMSEnum::SymbolUpdateType updateType = GAMSEnum::SymbolUpdateType::BaseCase);
 
+    /// Solve model instance and pass the solver log to a handler while the solver is running.
+    /// \param updateType Update type.
+    /// \param logHandler Handler receiving the log lines and the progress of the solver.
+    /// \param miOpt GAMSModelInstance options.
+    /// \param logInterval Minimum time between two calls of the handler; lines in between are skipped
+    ///        but still update the progress. The last line is always passed. Zero passes every line.
+    void solve(GAMSEnum::SymbolUpdateType updateType, const SolverLogHandler& logHandler,
+               const GAMSModelInstanceOpt& miOpt = GAMSModelInstanceOpt(),
+               std::chrono::milliseconds logInterval = std::chrono::milliseconds::zero());
+
+    /// Solve a batch of scenarios one after another.
+    /// \remark For every scenario the values of the scenario columns are written into the modifier
+    ///         data symbols, the model instance is solved and status, objective value and the
+    ///         requested records are stored in the result columns. After the first scenario only the
+    ///         records of the scenario columns are pushed into the model instance, records are resolved
+    ///         once for the whole batch and the result buffers are reused.
+    /// \param scenarios Scenario values given as columns of modifier data records.
+    /// \param results Result buffers, resized to the number of scenarios.
+    /// \param updateType Update type.
+    void solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                    GAMSEnum::SymbolUpdateType updateType = GAMSEnum::SymbolUpdateType::BaseCase);
+
+    /// Solve a batch of scenarios one after another.
+    /// \param scenarios Scenario values given as columns of modifier data records.
+    /// \param results Result buffers, resized to the number of scenarios.
+    /// \param updateType Update type.
+    /// \param miOpt GAMSModelInstance options used for every scenario.
+    void solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                    GAMSEnum::SymbolUpdateType updateType, const GAMSModelInstanceOpt &miOpt);
+
+    /// Solve model instance in a library thread.
+    /// \remark The model instance must not be used until the returned handle reports a result,
+    ///         another solve throws a GAMSException until then.
+    /// \param miOpt GAMSModelInstance options.
+    /// \param timeLimit Wall-clock budget of the solve, the solver is interrupted when it expires.
+    ///        Zero means no limit.
+    /// \param updateType Update type.
+    /// \return Returns the handle of the running solve.
+    GAMSSolveHandle solveAsync(const GAMSModelInstanceOpt& miOpt = GAMSModelInstanceOpt(),
+                               std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+                               GAMSEnum::SymbolUpdateType updateType = GAMSEnum::SymbolUpdateType::BaseCase);
+
+    /// Race several solvers or option files on the same model and take the first acceptable result.
+    /// \remark The first alternative is solved by this model instance, every other alternative by a
+    ///         copy of it (see copyModelInstance). As soon as a result is accepted all other solvers
+    ///         are interrupted. If no result is accepted, the handle reports the first solve that returned.
+    ///         The model instance must not be used until the returned handle reports a result,
+    ///         another solve throws a GAMSException until then.
+    /// \param alternatives GAMSModelInstance options of the competing solves.
+    /// \param timeLimit Wall-clock budget of the whole portfolio including the copies of the model instance,
+    ///        zero means no limit.
+    /// \param acceptable Check deciding if a result is acceptable. By default a result is accepted if the
+    ///        solve completed normally with an optimal, integer or solved model status.
+    /// \param updateType Update type.
+    /// \return Returns the handle of the running portfolio.
+    GAMSSolveHandle solvePortfolio(const std::vector<GAMSModelInstanceOpt>& alternatives,
+                                   std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+                                   const Acceptance& acceptable = nullptr,
+                                   GAMSEnum::SymbolUpdateType updateType = GAMSEnum::SymbolUpdateType::BaseCase);
+
     /// Get model state.
     GAMSEnum::ModelStat modelStatus();
 
@@ -212,6 +289,76 @@ public:
     /// Get solve state as string.
     std::string solveStatusAsString();
 
+    /// Get the number of data records pushed into the model instance by the last solve.
+    /// \remark Only records modified since the last solve are pushed, all records of a modifier are
+    ///         pushed on the first solve, after a change of the update type, for Primal/Dual modifiers,
+    ///         and if a record got deleted with UpdateType=BaseCase.
+    int lastSolveUpdatedRecords();
+
+    /// Get the number of modifiers skipped by the last solve because their data did not change.
+    int lastSolveSkippedModifiers();
+
+    /// Get the number of iterations the solver used in the last solve.
+    int lastSolveIterations();
+
+    /// Get the timings and counts of the last solve.
+    /// \return Returns the statistics of the last solve (all zero if the model instance has not been solved).
+    GAMSModelInstanceStats lastSolveStats();
+
+    /// Get the histogram of the time spent in one phase of all solves of this model instance.
+    /// Bucket 0 counts the solves that spent less than 1 microsecond in the phase, bucket i counts
+    /// the solves that spent at least 2^(i-1) and less than 2^i microseconds. The last bucket also
+    /// counts all longer solves.
+    /// \param phase Phase of the solves.
+    /// \return Returns the number of solves per bucket.
+    std::vector<int> solveStatsHistogram(GAMSModelInstanceStats::Phase phase);
+
+    /// Clear the histograms of the solves of this model instance.
+    void resetSolveStatsHistogram();
+
+    /// Store the current primal/dual solution and basis of the model instance in memory.
+    /// \remark The snapshot can be used as start point of a later solve, see GAMSModelInstanceOpt::setStartSnapshot.
+    ///         An existing snapshot with the same name is replaced.
+    /// \param name Snapshot name.
+    void saveSnapshot(const std::string &name);
+
+    /// Load the primal/dual solution and basis of a snapshot into the model instance.
+    /// \param name Snapshot name.
+    void restoreSnapshot(const std::string &name);
+
+    /// Exchange the current primal/dual solution and basis of the model instance with a snapshot.
+    /// \param name Snapshot name.
+    void swapSnapshot(const std::string &name);
+
+    /// Check if a snapshot exists.
+    /// \param name Snapshot name.
+    /// \return Returns <c>true</c> if the snapshot exists; otherwise <c>false</c>.
+    bool hasSnapshot(const std::string &name);
+
+    /// Remove a snapshot.
+    /// \param name Snapshot name.
+    void removeSnapshot(const std::string &name);
+
+    /// Get the number of records of a variable or equation in the model instance.
+    /// \param symbol Name of the variable or equation.
+    /// \return Returns the number of values extractSolution writes per buffer.
+    int solutionRecords(const std::string &symbol);
+
+    /// Get the keys of the records of a variable or equation in the order used by extractSolution.
+    /// \remark The order is fixed when the model instance is instantiated and computed once.
+    /// \param symbol Name of the variable or equation.
+    /// \return Returns the keys of every record.
+    std::vector<std::vector<std::string>> solutionKeys(const std::string &symbol);
+
+    /// Copy the levels and marginals of a variable or equation of the last solve into caller buffers.
+    /// \remark The values are taken from the solver interface directly, without the records of the
+    ///         synchronization database. Only the records of the symbol are read. This includes an
+    ///         objective variable that the solver turned into an objective function.
+    /// \param symbol Name of the variable or equation.
+    /// \param levels Buffer for solutionRecords(symbol) levels, or nullptr to skip the levels.
+    /// \param marginals Buffer for solutionRecords(symbol) marginals, or nullptr to skip the marginals.
+    void extractSolution(const std::string &symbol, double *levels, double *marginals = nullptr);
+
     /// Copies this ModelInstance to a new ModelInstance.
     /// \param modelInstanceName Identifier of GAMSModelInstance (determined automatically if omitted).
     /// \return Returns the new ModelInstance.
@@ -234,6 +381,7 @@ public:
 
 private:
     friend class GAMSCheckpointImpl;
+    friend class GAMSSolveHandleImpl;
     GAMSModelInstance(const std::shared_ptr<GAMSModelInstanceImpl>& impl);
     GAMSModelInstance(GAMSCheckpoint& checkpoint, const std::string& modelInstanceName = "");
 
@@ -36,13 +36,20 @@
 #include "gevmcc.h"
 #include "gmomcc.h"
 #include "gamsversion.h"
+#include "gamsplatform.h"
+#include "gamsworkspaceimpl.h"
+#include "gamsjobimpl.h"
+#include "gamssolverlogparser.h"
 
+#include <algorithm>
 #include <cassert>
 #include <filesystem>
 #include <iostream>
 #include <memory>
 #include <stdlib.h>
 #include <fstream>
+#include <sstream>
+#include <mutex>
 
 using namespace std;
 namespace fs = std::filesystem;
@@ -54,16 +61,15 @@ GAMSModelInstanceImpl::GAMSModelInstanceImpl(GAMSCheckpoint& checkpoint,
     : mCheckpoint(checkpoint)
     , mModelInstanceName(modelInstanceName)
 {
-    char msg[GMS_SSSIZE];
     GAMSWorkspace ws = mCheckpoint.workspace();
-    mScrDir = GAMSPath(ws.workingDirectory()) / mModelInstanceName;
+    GAMSPath scrRoot = ws.mImpl->modelInstanceScratchRoot();
+    mScrDir = scrRoot / mModelInstanceName;
+    mOwnScrDir = scrRoot != GAMSPath(ws.workingDirectory());
     mSyncDb = GAMSDatabase(ws, ws.specValues());
     dbLockRecords();
 
-    if (!gevCreateD(&mGEV, ws.systemDirectory().c_str(), msg, sizeof(msg)))
-        throw GAMSException(std::string(msg));
-    if (!gmoCreateD(&mGMO, ws.systemDirectory().c_str(), msg, sizeof(msg)))
-        throw GAMSException(std::string(msg));
+    mGEV = ws.mImpl->handlePool().createGev(ws.systemDirectory());
+    mGMO = ws.mImpl->handlePool().createGmo(ws.systemDirectory());
     mInstantiated = false;
 }
 
@@ -86,16 +92,17 @@ GAMSModelInstanceImpl::GAMSModelInstanceImpl(std::shared_ptr<GAMSModelInstanceIm
         this->mModelInstanceName = modelInstanceName;
     }
 
-    mScrDir = GAMSPath(mCheckpoint.workspace().workingDirectory()) / mModelInstanceName;
+    GAMSWorkspace ws = mCheckpoint.workspace();
+    GAMSPath scrRoot = ws.mImpl->modelInstanceScratchRoot();
+    mScrDir = scrRoot / mModelInstanceName;
+    mOwnScrDir = scrRoot != GAMSPath(ws.workingDirectory());
     if (mScrDir.exists()) {
         mScrDir.rmDirRecurse();
     }
     mSyncDb = mCheckpoint.workspace().addDatabase(sourceMI->mSyncDb);
 
-    if (!gevCreateD(&mGEV, mCheckpoint.workspace().systemDirectory().c_str(), msg, sizeof(msg)))
-        throw GAMSException(std::string(msg));
-    if (!gmoCreateD(&mGMO, mCheckpoint.workspace().systemDirectory().c_str(), msg, sizeof(msg)))
-        throw GAMSException(std::string(msg));
+    mGEV = ws.mImpl->handlePool().createGev(ws.systemDirectory());
+    mGMO = ws.mImpl->handlePool().createGmo(ws.systemDirectory());
 
     for (GAMSModifier& mod : sourceMI->mModifiers) {
         try {
@@ -129,6 +136,7 @@ GAMSModelInstanceImpl::GAMSModelInstanceImpl(std::shared_ptr<GAMSModelInstanceIm
 
     this->mLogAvailable = sourceMI->mLogAvailable;
     this->mSelectedSolver = sourceMI->mSelectedSolver;
+    this->mSnapshots = sourceMI->mSnapshots;
 
     char buffer[GMS_SSSIZE];
     string optFileName = gmoNameOptFile(sourceMI->mGMO, buffer);
@@ -142,10 +150,15 @@ GAMSModelInstanceImpl::GAMSModelInstanceImpl(std::shared_ptr<GAMSModelInstanceIm
 GAMSModelInstanceImpl::~GAMSModelInstanceImpl()
 {
     gmdCloseLicenseSession(gmd());
+    GAMSHandlePool &pool = mCheckpoint.workspace().mImpl->handlePool();
+    if (mDeltaGMD != NULL)
+        pool.freeGmd(mDeltaGMD);
     if (mGMO != NULL)
-        gmoFree(&mGMO);
+        pool.freeGmo(mGMO);
     if (mGEV != NULL)
-        gevFree(&mGEV);
+        pool.freeGev(mGEV);
+    if (mOwnScrDir && mCheckpoint.workspace().mImpl->removeFiles())
+        mScrDir.rmDirRecurse();
 }
 
 bool GAMSModelInstanceImpl::operator!=(const GAMSModelInstanceImpl& other) const
@@ -253,7 +266,7 @@ void GAMSModelInstanceImpl::instantiate(const std::string& modelDefinition,
         model += " scenario dict;";
     }
 
-    GAMSJob myJob = mCheckpoint.workspace().addJobFromString(model, mCheckpoint, "");
+    GAMSWorkspace ws = mCheckpoint.workspace();
     tmpOpt.setScrDir(mScrDir);
     if (mCheckpoint.workspace().debug() >= GAMSEnum::DebugLevel::ShowLog) {
         tmpOpt.setLogOption(4);
@@ -267,10 +280,20 @@ void GAMSModelInstanceImpl::instantiate(const std::string& modelDefinition,
     tmpOpt.setLogFile(mScrDir / "gamslog.dat");
     tmpOpt.setSolverCntr("gamscntr.dat");
 
-    myJob.run(tmpOpt);
+    string cacheKey;
+    bool fromCache = false;
+    if (ws.instantiationCache()) {
+        cacheKey = instantiationCacheKey(model, tmpOpt);
+        string controlFile = ws.mImpl->cachedInstantiation(cacheKey);
+        fromCache = !controlFile.empty() && initFromCachedScratchDir(controlFile);
+    }
+    if (!fromCache) {
+        GAMSJob myJob = ws.addJobFromString(model, mCheckpoint, "");
+        myJob.run(tmpOpt);
 
-    if (gevInitEnvironmentLegacy(mGEV, (mScrDir / tmpOpt.solverCntr()).c_str()) != 0)
-        throw GAMSException("Could not initialize model instance");
+        if (gevInitEnvironmentLegacy(mGEV, (mScrDir / tmpOpt.solverCntr()).c_str()) != 0)
+            throw GAMSException("Could not initialize model instance");
+    }
 
     char buf[GMS_SSSIZE];
     gmoRegisterEnvironment(mGMO, mGEV, buf);
@@ -285,36 +308,256 @@ void GAMSModelInstanceImpl::instantiate(const std::string& modelDefinition,
 
     checkForGMDError(gmdInitFromDict(gmd(), mGMO), __FILE__, __LINE__);
 
+    if (!cacheKey.empty() && !fromCache)
+        cacheScratchDir(cacheKey);
+
     mInstantiated = true;
     dbLockSymbols();
 }
 
+void GAMSModelInstanceImpl::startSolve()
+{
+    if (mSolving.exchange(true))
+        throw GAMSException("Model instance " + mModelInstanceName + " is already solving");
+}
+
+string GAMSModelInstanceImpl::instantiationCacheKey(const string &model, GAMSOptions &options)
+{
+    GAMSWorkspace ws = mCheckpoint.workspace();
+    string key = model + '\n' + ws.version() + '\n' + ws.systemDirectory() + '\n' + mCheckpoint.fileName() + '\n';
+    error_code ec;
+    auto modified = fs::last_write_time(mCheckpoint.fileName(), ec);
+    key += to_string(modified.time_since_epoch().count()) + '\n';
+
+    // options naming the scratch directory differ per instance
+    istringstream pf(GAMSJobImpl::optionFileText(options, (mScrDir / "instantiate.pf").toStdString()));
+    string line;
+    while (getline(pf, line)) {
+        if (line.find(mScrDir.toStdString()) == string::npos)
+            key += line + '\n';
+    }
+    return GAMSPlatform::contentHash(key);
+}
+
+bool GAMSModelInstanceImpl::initFromCachedScratchDir(const string &controlFile)
+{
+    // the environment of the cached directory is only needed to duplicate it
+    static mutex duplicateLock;
+    lock_guard<mutex> lck(duplicateLock);
+    char msg[GMS_SSSIZE];
+    gevHandle_t cacheGEV;
+    if (!gevCreateD(&cacheGEV, mCheckpoint.workspace().systemDirectory().c_str(), msg, sizeof(msg)))
+        return false;
+    char ctrlFN[GMS_SSSIZE];
+    bool duplicated = gevInitEnvironmentLegacy(cacheGEV, controlFile.c_str()) == 0 &&
+                      gevDuplicateScratchDir(cacheGEV, mScrDir.c_str(), (mScrDir / "gamslog.dat").c_str(), ctrlFN) == 0;
+    gevFree(&cacheGEV);
+    if (!duplicated)
+        return false;
+    if (gevInitEnvironmentLegacy(mGEV, ctrlFN) != 0)
+        throw GAMSException("Could not initialize model instance");
+    return true;
+}
+
+void GAMSModelInstanceImpl::cacheScratchDir(const string &cacheKey)
+{
+    GAMSWorkspace ws = mCheckpoint.workspace();
+    GAMSPath cacheDir = ws.mImpl->modelInstanceScratchRoot() / (ws.scratchFilePrefix() + "ic_" + cacheKey);
+    if (!ws.mImpl->cachedInstantiation(cacheKey).empty() || cacheDir.exists())
+        return;
+    char ctrlFN[GMS_SSSIZE];
+    if (gevDuplicateScratchDir(mGEV, cacheDir.c_str(), (cacheDir / "gamslog.dat").c_str(), ctrlFN) != 0) {
+        // the instance works without the cache
+        cacheDir.rmDirRecurse();
+        return;
+    }
+    ws.mImpl->addCachedInstantiation(cacheKey, ctrlFN, cacheDir);
+}
+
 
-void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream* output, GAMSModelInstanceOpt miOpt)
+/// Switches the solver log of a GEV to stdout or a callback and restores the previous switches in
+/// reverse order, also if the solve throws
+class LogSwitches
+{
+public:
+    LogSwitches(gevHandle_t gev) : mGEV(gev) {}
+    ~LogSwitches() { restore(); }
+
+    /// Switch the log to stdout or, if given, to a callback, the files keep their names
+    void switchTo(Tgevlswrite_t callback, void *usrmem)
+    {
+        char logFile[GMS_SSSIZE], staFile[GMS_SSSIZE];
+        mHandles.push_back(nullptr);
+        gevSwitchLogStat(mGEV, 3, gevGetStrOpt(mGEV, gevNameLogFile, logFile), false,
+                         gevGetStrOpt(mGEV, gevNameStaFile, staFile), false, callback, usrmem, &mHandles.back());
+    }
+
+    /// Restore the switches, the last switch first
+    void restore()
+    {
+        while (!mHandles.empty()) {
+            gevRestoreLogStat(mGEV, &mHandles.back());
+            mHandles.pop_back();
+        }
+    }
+
+private:
+    gevHandle_t mGEV;
+    vector<void*> mHandles;
+};
+
+/// Receives the solver log from GEV and passes complete lines to a GAMSModelInstance::SolverLogHandler
+class SolverLogReceiver
+{
+public:
+    SolverLogReceiver(gevHandle_t gev, const GAMSModelInstance::SolverLogHandler &handler, chrono::milliseconds interval)
+        : mGEV(gev), mHandler(handler), mInterval(interval), mStart(chrono::steady_clock::now())
+    {}
+
+    static void GEV_CALLCONV write(const char *msg, int mode, void *usrmem)
+    {
+        // mode 2 is the status file only
+        if (mode != 2)
+            static_cast<SolverLogReceiver*>(usrmem)->receive(msg);
+    }
+
+    /// Time spent in the handler
+    chrono::nanoseconds handlerTime() const { return mHandlerTime; }
+
+    /// Pass the remaining output to the handler and rethrow an exception of the handler
+    void finish()
+    {
+        if (!mPending.empty())
+            addLine(mPending);
+        if (mSkipped && !mError)
+            call(mLastLine);
+        if (mError)
+            rethrow_exception(mError);
+    }
+
+private:
+    void receive(const char *msg)
+    {
+        for (const char *c = msg; *c; ++c) {
+            if (*c == '\n') {
+                addLine(mPending);
+                mPending.clear();
+            } else if (*c != '\r') {
+                mPending += *c;
+            }
+        }
+    }
+
+    void addLine(const string &line)
+    {
+        mProgress.lines++;
+        mParser.parse(line, mProgress);
+        if (mError)
+            return;
+        auto now = chrono::steady_clock::now();
+        if (mInterval.count() > 0 && mProgress.lines > 1 && now - mLastCall < mInterval) {
+            mLastLine = line;
+            mSkipped = true;
+            return;
+        }
+        mLastCall = now;
+        call(line);
+    }
+
+    void call(const string &line)
+    {
+        mSkipped = false;
+        auto now = chrono::steady_clock::now();
+        mProgress.elapsed = chrono::duration_cast<chrono::milliseconds>(now - mStart);
+        try {
+            mHandler(line, mProgress);
+        } catch (...) {
+            // exceptions cannot pass the solver, so the solve is stopped and the exception rethrown afterwards
+            mError = current_exception();
+            gevTerminateRaise(mGEV);
+        }
+        mHandlerTime += chrono::steady_clock::now() - now;
+    }
+
+    gevHandle_t mGEV;
+    const GAMSModelInstance::SolverLogHandler &mHandler;
+    chrono::milliseconds mInterval;
+    chrono::steady_clock::time_point mStart;
+    chrono::steady_clock::time_point mLastCall;
+    GAMSSolverProgress mProgress;
+    GAMSSolverLogParser mParser;
+    string mPending;
+    string mLastLine;
+    bool mSkipped = false;
+    exception_ptr mError;
+    chrono::nanoseconds mHandlerTime = chrono::nanoseconds::zero();
+};
+
+void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream* output, GAMSModelInstanceOpt miOpt,
+                                  const GAMSModelInstance::SolverLogHandler &logHandler, chrono::milliseconds logInterval)
 {
     int noMatchLimit = miOpt.noMatchLimit();
     if (!mInstantiated)
         throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
 
+    GAMSModelInstanceStats stats;
+    auto phaseStart = chrono::steady_clock::now();
+    auto phaseEnd = [&phaseStart]() {
+        auto now = chrono::steady_clock::now();
+        chrono::nanoseconds time = now - phaseStart;
+        phaseStart = now;
+        return time;
+    };
+
+    const bool haveStartSnapshot = !miOpt.startSnapshot().empty();
+    if (haveStartSnapshot && !miOpt.startSnapshotOverridesUpdate())
+        loadSolution(snapshot(miOpt.startSnapshot()));
+
+    solutionChanged();
     checkForGMDError(gmdInitUpdate(gmd(), mGMO), __FILE__, __LINE__);
 
     int accumulateNoMatchCnt = 0;
-    int noMatchCnt = 0;
-    for (GAMSModifier mod: mModifiers) {
-        int locIntSUT = updateType;
-        // If user sets the updateType to Inherit on the Solve call use BaseCase
-        if (updateType == GAMSEnum::SymbolUpdateType::Inherit)
-            locIntSUT = GAMSEnum::SymbolUpdateType::BaseCase;
+    mModifierSync.resize(mModifiers.size());
+    // taken once per data symbol, several modifiers may share one
+    map<void*, GAMSDatabaseImpl::SymbolChanges> changes;
+    try {
+        for (size_t i = 0; i < mModifiers.size(); ++i) {
+            GAMSModifier &mod = mModifiers[i];
+            int locIntSUT = updateType;
+            // If user sets the updateType to Inherit on the Solve call use BaseCase
+            if (updateType == GAMSEnum::SymbolUpdateType::Inherit)
+                locIntSUT = GAMSEnum::SymbolUpdateType::BaseCase;
 
-        if (mod.updType() != GAMSEnum::SymbolUpdateType::Inherit)
-            locIntSUT = mod.updType();
+            if (mod.updType() != GAMSEnum::SymbolUpdateType::Inherit)
+                locIntSUT = mod.updType();
 
-        int result = gmdUpdateModelSymbol(gmd(), mod.gamsSymbol().symPtr(), mod.updAction(), mod.dataSymbol().symPtr(), locIntSUT, &noMatchCnt);
-        checkForGMDError(result, __FILE__, __LINE__);
-        accumulateNoMatchCnt += noMatchCnt;
-        if (accumulateNoMatchCnt > noMatchLimit)
-            throw GAMSException("Unmatched record limit exceeded while processing modifier " + mod.gamsSymbol().name());
+            GAMSParameter dataSym = mod.dataSymbol();
+            void *dataSymPtr = dataSym.symPtr();
+            if (!changes.count(dataSymPtr)) {
+                trackChanges(dataSymPtr);
+                changes[dataSymPtr] = takeChanges(dataSymPtr);
+            }
+            int noMatchCnt = 0;
+            stats.updatedRecords += updateModifier(mod, mModifierSync[i], locIntSUT, changes[dataSymPtr], noMatchCnt);
+            if (noMatchCnt < 0) {
+                ++stats.skippedModifiers;
+                continue;
+            }
+            accumulateNoMatchCnt += noMatchCnt;
+            stats.unmatchedRecords = accumulateNoMatchCnt;
+            if (accumulateNoMatchCnt > noMatchLimit)
+                throw GAMSException("Unmatched record limit exceeded while processing modifier " + mod.gamsSymbol().name());
+        }
+    } catch (...) {
+        // the changes taken for the remaining modifiers are lost, the next solve pushes everything
+        for (ModifierSync &sync : mModifierSync)
+            sync.updateType = -1;
+        throw;
     }
+    if (haveStartSnapshot && miOpt.startSnapshotOverridesUpdate())
+        loadSolution(snapshot(miOpt.startSnapshot()));
+    stats.updateTime = phaseEnd();
+
     // Close Log and status file and remove
     void *lshandle = nullptr;
     if (mLogAvailable && output != nullptr) {
@@ -322,10 +565,14 @@ void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream
         gevRestoreLogStatRewrite(mGEV, &lshandle);
     }
 
-    if (output == &cout) {
-        char buffer[GMS_SSSIZE], buffer1[GMS_SSSIZE];
-        gevSwitchLogStat(mGEV, 3, gevGetStrOpt(mGEV, gevNameLogFile, buffer), false, gevGetStrOpt(mGEV, gevNameStaFile, buffer1), false, nullptr, nullptr, &lshandle);
-    }
+    // the receiver has to outlive the switches, GEV calls it until they are restored
+    SolverLogReceiver logReceiver(mGEV, logHandler, logInterval);
+    LogSwitches logSwitches(mGEV);
+    if (output == &cout)
+        logSwitches.switchTo(nullptr, nullptr);
+    // the handler switch saves the state of the cout switch, both are restored in reverse order
+    if (logHandler)
+        logSwitches.switchTo(&SolverLogReceiver::write, &logReceiver);
 
     {
         std::string tmpSolver = mSelectedSolver;
@@ -345,8 +592,26 @@ void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream
         fs::path p = saveNameOptFile;
         GAMSPath optFile(GAMSPath(p.remove_filename()) / (tmpSolver + "." + mCheckpoint.workspace().optFileExtension(tmpOptFile)));
         gmoNameOptFileSet(mGMO, optFile.c_str());
+        stats.logTime = phaseEnd();
 
-        checkForGMDError(gmdCallSolver(gmd(), tmpSolver.c_str()), __FILE__, __LINE__);
+        try {
+            checkForGMDError(gmdCallSolver(gmd(), tmpSolver.c_str()), __FILE__, __LINE__);
+        } catch (...) {
+            // e.g. an unknown solver, the next solve starts from the options of the instance
+            gmoOptFileSet(mGMO, saveOptFile);
+            gmoNameOptFileSet(mGMO, saveNameOptFile.c_str());
+            throw;
+        }
+        // the solver reports its own resource usage, the rest of the call is spent outside of the solver
+        chrono::nanoseconds callTime = phaseEnd() - logReceiver.handlerTime();
+        stats.logTime += logReceiver.handlerTime();
+        stats.solverTime = min(callTime, chrono::duration_cast<chrono::nanoseconds>(
+                                   chrono::duration<double>(gmoGetHeadnTail(mGMO, gmoHresused))));
+        stats.syncTime = callTime - stats.solverTime;
+        stats.iterations = gmoIterUsed(mGMO);
+        stats.nodes = gmoNodUsed(mGMO);
+        if (!miOpt.resultSnapshot().empty())
+            mSnapshots[miOpt.resultSnapshot()] = currentSolution();
 
         if (miOpt.debug()) {
             GAMSPath miDir(GAMSPath(mCheckpoint.workspace().workingDirectory()) / mModelInstanceName);
@@ -365,9 +630,11 @@ void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream
 
         gmoOptFileSet(mGMO, saveOptFile);
         gmoNameOptFileSet(mGMO, saveNameOptFile.c_str());
+        phaseEnd();
     }
-    if (output == &cout)
-        gevRestoreLogStat(mGEV, &lshandle);
+    logSwitches.restore();
+    if (logHandler)
+        logReceiver.finish();
 
     if (output != nullptr && output != &cout)
     {
@@ -384,5 +651,442 @@ void GAMSModelInstanceImpl::solve(GAMSEnum::SymbolUpdateType updateType, ostream
         else
             *output << "No solver log available" << '\n';
     }
+    stats.logTime += phaseEnd();
+    recordSolveStats(stats);
+}
+
+/// Throws the last error of a GMD handle not owned by a GAMSDatabase
+static void checkForHandleError(gmdHandle_t gmd, int retcode, const string &file, int linenr)
+{
+    if (retcode != 1) {
+        char msg[GMS_SSSIZE];
+        gmdGetLastError(gmd, msg);
+        throw GAMSException(msg + (" at [" + file) + ", " + to_string(linenr) + "]");
+    }
+}
+
+gmdHandle_t GAMSModelInstanceImpl::deltaGmd()
+{
+    if (mDeltaGMD)
+        return mDeltaGMD;
+    GAMSWorkspace ws = mCheckpoint.workspace();
+    gmdHandle_t deltaGMD = ws.mImpl->handlePool().createGmd(ws.systemDirectory());
+    try {
+        checkForHandleError(deltaGMD, gmdSetSpecialValues(deltaGMD, ws.specValues()), __FILE__, __LINE__);
+        checkForHandleError(deltaGMD, gmdInitFromDict(deltaGMD, mGMO), __FILE__, __LINE__);
+    } catch (...) {
+        ws.mImpl->handlePool().freeGmd(deltaGMD);
+        throw;
+    }
+    mDeltaGMD = deltaGMD;
+    return mDeltaGMD;
+}
+
+void *GAMSModelInstanceImpl::deltaSymbol(int dim)
+{
+    void *&symPtr = mDeltaSymbols[dim];
+    if (!symPtr) {
+        gmdHandle_t deltaGMD = deltaGmd();
+        // model symbols of the private GMD keep their names
+        string name = "gamscpp_delta" + to_string(dim);
+        void *existing = nullptr;
+        while (gmdFindSymbol(deltaGMD, name.c_str(), &existing) && existing)
+            name += '_';
+        checkForHandleError(deltaGMD, gmdAddSymbol(deltaGMD, name.c_str(), dim, GAMSEnum::SymTypePar, 0,
+                                                   "modified records of a modifier", &symPtr), __FILE__, __LINE__);
+    }
+    return symPtr;
+}
+
+void *GAMSModelInstanceImpl::deltaModelSymbol(const string &name)
+{
+    void *&symPtr = mDeltaModelSymbols[name];
+    if (!symPtr && (!gmdFindSymbol(deltaGmd(), name.c_str(), &symPtr) || !symPtr)) {
+        mDeltaModelSymbols.erase(name);
+        throw GAMSException("Symbol " + name + " not found in model instance " + mModelInstanceName);
+    }
+    return symPtr;
+}
+
+int GAMSModelInstanceImpl::updateModifier(GAMSModifier &mod, ModifierSync &sync, int updateType,
+                                          const GAMSDatabaseImpl::SymbolChanges &changes, int &noMatchCnt)
+{
+    GAMSParameter dataSym = mod.dataSymbol();
+    // Levels and marginals are overwritten by the solver and have to be pushed every time.
+    bool full = mod.updAction() == GAMSEnum::SymbolUpdateAction::Primal
+            || mod.updAction() == GAMSEnum::SymbolUpdateAction::Dual
+            || sync.updateType != updateType || changes.all;
+    if (!full && changes.records.empty()) {
+        // the GMO keeps the values of the last update
+        noMatchCnt = -1;
+        return 0;
+    }
+
+    // Records not in the data symbol are left alone by Accumulate, so the modified records alone
+    // bring the GMO to the state a full update would produce. Deleted records fall back to zero
+    // (Zero) or are kept (Accumulate); BaseCase has to restore them from the instantiation.
+    vector<pair<const vector<string>*, double>> records;
+    if (!full) {
+        int dim = dataSym.dim();
+        records.reserve(changes.records.size());
+        vector<const char*> keys(dim);
+        for (const vector<string> &key : changes.records) {
+            for (int d = 0; d < dim; ++d)
+                keys[d] = key[d].c_str();
+            void *symIterPtr = nullptr;
+            double value = 0.0;
+            if (gmdFindRecord(gmd(), dataSym.symPtr(), keys.data(), &symIterPtr)) {
+                gmdGetLevel(gmd(), symIterPtr, &value);
+                gmdFreeSymbolIterator(gmd(), symIterPtr);
+            } else if (updateType == GAMSEnum::SymbolUpdateType::BaseCase) {
+                full = true;
+                break;
+            } else if (updateType == GAMSEnum::SymbolUpdateType::Accumulate) {
+                continue;
+            }
+            records.emplace_back(&key, value);
+        }
+        // beyond half of the records a full update is cheaper than copying them
+        if (2 * records.size() > static_cast<size_t>(dataSym.numberRecords()))
+            full = true;
+        else if (!full && records.empty()) {
+            noMatchCnt = -1;
+            return 0;
+        }
+    }
+
+    int pushed;
+    if (full) {
+        int result = gmdUpdateModelSymbol(gmd(), mod.gamsSymbol().symPtr(), mod.updAction(), dataSym.symPtr(),
+                                          updateType, &noMatchCnt);
+        checkForGMDError(result, __FILE__, __LINE__);
+        pushed = dataSym.numberRecords();
+    } else {
+        // the modified records go through a private GMD, SyncDB only holds the symbols of the user
+        gmdHandle_t deltaGMD = deltaGmd();
+        void *modelSymPtr = deltaModelSymbol(mod.gamsSymbol().name());
+        void *deltaPtr = deltaSymbol(dataSym.dim());
+        checkForHandleError(deltaGMD, gmdClearSymbol(deltaGMD, deltaPtr), __FILE__, __LINE__);
+        vector<const char*> keys(dataSym.dim());
+        for (const auto &record : records) {
+            for (int d = 0; d < dataSym.dim(); ++d)
+                keys[d] = (*record.first)[d].c_str();
+            void *symIterPtr = nullptr;
+            checkForHandleError(deltaGMD, gmdAddRecord(deltaGMD, deltaPtr, keys.data(), &symIterPtr), __FILE__, __LINE__);
+            checkForHandleError(deltaGMD, gmdSetLevel(deltaGMD, symIterPtr, record.second), __FILE__, __LINE__);
+            gmdFreeSymbolIterator(deltaGMD, symIterPtr);
+        }
+        int result = gmdUpdateModelSymbol(deltaGMD, modelSymPtr, mod.updAction(), deltaPtr,
+                                          GAMSEnum::SymbolUpdateType::Accumulate, &noMatchCnt);
+        checkForHandleError(deltaGMD, result, __FILE__, __LINE__);
+        pushed = static_cast<int>(records.size());
+    }
+    sync.updateType = updateType;
+    return pushed;
+}
+
+void GAMSModelInstanceImpl::solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                                       GAMSEnum::SymbolUpdateType updateType, const GAMSModelInstanceOpt &miOpt)
+{
+    if (!mInstantiated)
+        throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
+
+    // The records are resolved once, scenario values and results go straight through GMD
+    struct Record
+    {
+        void *symPtr;
+        std::vector<const char*> keys;
+        void *symIterPtr;
+        /// Keys as stored in GMD, reported as modified records of the scenario inputs
+        std::vector<std::string> labels;
+    };
+    struct Records : std::vector<Record>
+    {
+        gmdHandle_t gmd;
+        ~Records() {
+            for (Record &rec : *this)
+                if (rec.symIterPtr)
+                    gmdFreeSymbolIterator(gmd, rec.symIterPtr);
+        }
+    };
+    auto keyPtrs = [](const vector<string> &keys) {
+        vector<const char*> ptrs;
+        ptrs.reserve(keys.size());
+        for (const string &key : keys)
+            ptrs.push_back(key.c_str());
+        return ptrs;
+    };
+
+    Records inputs;
+    inputs.gmd = gmd();
+    inputs.reserve(scenarios.columns.size());
+    for (const GAMSBatchScenarios::Column &col : scenarios.columns) {
+        if (col.symbol.database() != mSyncDb)
+            throw GAMSException("Symbol " + col.symbol.name() + " not part of SyncDB");
+        inputs.push_back(Record{col.symbol.symPtr(), keyPtrs(col.keys), nullptr, {}});
+        Record &rec = inputs.back();
+        if (!gmdFindRecord(inputs.gmd, rec.symPtr, rec.keys.data(), &rec.symIterPtr)) {
+            rec.symIterPtr = nullptr;
+            checkForGMDError(gmdAddRecord(inputs.gmd, rec.symPtr, rec.keys.data(), &rec.symIterPtr), __FILE__, __LINE__);
+        }
+        gdxStrIndex_t keyData;
+        gdxStrIndexPtrs_t labelPtrs;
+        GDXSTRINDEXPTRS_INIT(keyData, labelPtrs);
+        int dim = col.symbol.dim();
+        checkForGMDError(gmdGetKeys(inputs.gmd, rec.symIterPtr, dim, labelPtrs), __FILE__, __LINE__);
+        rec.labels.assign(labelPtrs, labelPtrs + dim);
+    }
+    vector<Record> outputs;
+    outputs.reserve(results.columns.size());
+    for (const GAMSBatchResults::Column &col : results.columns) {
+        if (col.symbol.database() != mSyncDb)
+            throw GAMSException("Symbol " + col.symbol.name() + " not part of SyncDB");
+        outputs.push_back(Record{col.symbol.symPtr(), keyPtrs(col.keys), nullptr, {}});
+    }
+
+    const int count = scenarios.numberOfScenarios();
+    results.resize(count);
+    for (int s = 0; s < count; ++s) {
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            checkForGMDError(gmdSetLevel(inputs.gmd, inputs[i].symIterPtr, scenarios.columns[i].values[s]), __FILE__, __LINE__);
+            // only the scenario records are pushed by the solve
+            recordChanged(inputs[i].symPtr, inputs[i].labels);
+        }
+
+        solve(updateType, nullptr, miOpt);
+
+        results.modelStatus[s] = modelStatus();
+        results.solveStatus[s] = solveStatus();
+        results.objective[s] = gmoGetHeadnTail(mGMO, gmoHobjval);
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            // records of variables and equations are replaced by the solve, so they are looked up every time
+            void *symIterPtr = nullptr;
+            double val = 0.0;
+            if (gmdFindRecord(inputs.gmd, outputs[i].symPtr, outputs[i].keys.data(), &symIterPtr)) {
+                if (results.columns[i].value == GAMSBatchResults::Level)
+                    gmdGetLevel(inputs.gmd, symIterPtr, &val);
+                else
+                    gmdGetMarginal(inputs.gmd, symIterPtr, &val);
+                gmdFreeSymbolIterator(inputs.gmd, symIterPtr);
+            }
+            results.columns[i].values[s] = val;
+        }
+    }
+}
+
+void GAMSModelInstanceImpl::saveSnapshot(const string &name)
+{
+    if (!mInstantiated)
+        throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
+    mSnapshots[name] = currentSolution();
 }
+
+void GAMSModelInstanceImpl::restoreSnapshot(const string &name)
+{
+    if (!mInstantiated)
+        throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
+    loadSolution(snapshot(name));
+}
+
+void GAMSModelInstanceImpl::swapSnapshot(const string &name)
+{
+    if (!mInstantiated)
+        throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
+    SolutionSnapshot &stored = snapshot(name);
+    SolutionSnapshot current = currentSolution();
+    loadSolution(stored);
+    stored = std::move(current);
+}
+
+bool GAMSModelInstanceImpl::hasSnapshot(const string &name) const
+{
+    return mSnapshots.count(name) > 0;
+}
+
+void GAMSModelInstanceImpl::removeSnapshot(const string &name)
+{
+    mSnapshots.erase(name);
+}
+
+GAMSModelInstanceImpl::SolutionSnapshot GAMSModelInstanceImpl::currentSolution()
+{
+    SolutionSnapshot snapshot;
+    const int n = gmoN(mGMO);
+    const int m = gmoM(mGMO);
+    snapshot.varLevels.resize(n);
+    snapshot.varMarginals.resize(n);
+    snapshot.varStats.resize(n);
+    snapshot.equLevels.resize(m);
+    snapshot.equMarginals.resize(m);
+    snapshot.equStats.resize(m);
+    gmoGetVarL(mGMO, snapshot.varLevels.data());
+    gmoGetVarM(mGMO, snapshot.varMarginals.data());
+    gmoGetVarStat(mGMO, snapshot.varStats.data());
+    gmoGetEquL(mGMO, snapshot.equLevels.data());
+    gmoGetEquM(mGMO, snapshot.equMarginals.data());
+    gmoGetEquStat(mGMO, snapshot.equStats.data());
+    snapshot.haveBasis = gmoHaveBasis(mGMO) != 0;
+    return snapshot;
+}
+
+void GAMSModelInstanceImpl::loadSolution(const SolutionSnapshot &snapshot)
+{
+    if (static_cast<int>(snapshot.varLevels.size()) != gmoN(mGMO)
+            || static_cast<int>(snapshot.equLevels.size()) != gmoM(mGMO))
+        throw GAMSException("Snapshot does not match the dimensions of model instance " + mModelInstanceName);
+    gmoSetVarL(mGMO, snapshot.varLevels.data());
+    gmoSetVarM(mGMO, snapshot.varMarginals.data());
+    gmoSetVarStat(mGMO, snapshot.varStats.data());
+    gmoSetEquL(mGMO, snapshot.equLevels.data());
+    gmoSetEquM(mGMO, snapshot.equMarginals.data());
+    gmoSetEquStat(mGMO, snapshot.equStats.data());
+    gmoHaveBasisSet(mGMO, snapshot.haveBasis ? 1 : 0);
+    solutionChanged();
+}
+
+GAMSModelInstanceImpl::SolutionSnapshot &GAMSModelInstanceImpl::snapshot(const string &name)
+{
+    auto it = mSnapshots.find(name);
+    if (it == mSnapshots.end())
+        throw GAMSException("Model instance " + mModelInstanceName + " has no snapshot " + name);
+    return it->second;
+}
+
+int GAMSModelInstanceImpl::solutionRecords(const string &symbol)
+{
+    return static_cast<int>(solutionLayout(symbol).keys.size());
+}
+
+vector<vector<string>> GAMSModelInstanceImpl::solutionKeys(const string &symbol)
+{
+    return solutionLayout(symbol).keys;
+}
+
+void GAMSModelInstanceImpl::extractSolution(const string &symbol, double *levels, double *marginals)
+{
+    const SolutionLayout &layout = solutionLayout(symbol);
+    const int kinds[2] = { layout.equation ? 2 : 0, layout.equation ? 3 : 1 };
+    double *targets[2] = { levels, marginals };
+    for (int k = 0; k < 2; ++k) {
+        if (!targets[k] || layout.runs.empty())
+            continue;
+        const vector<double> &values = solutionValues(kinds[k]);
+        double *target = targets[k];
+        for (const pair<int, int> &run : layout.runs)
+            target = copy_n(values.begin() + run.first, run.second, target);
+    }
+}
+
+/// Split a GMO row or column name like x(seattle,'new york') into its symbol name and keys
+static void splitSolutionName(const char *name, string &symbol, vector<string> &keys)
+{
+    const char *p = name;
+    while (*p && *p != '(')
+        ++p;
+    symbol.assign(name, p);
+    transform(symbol.begin(), symbol.end(), symbol.begin(), [](unsigned char c) { return char(tolower(c)); });
+    keys.clear();
+    if (!*p)
+        return;
+    string key;
+    char quote = 0;
+    for (++p; *p; ++p) {
+        if (quote) {
+            if (*p == quote)
+                quote = 0;
+            else
+                key += *p;
+        } else if (*p == '\'' || *p == '"') {
+            quote = *p;
+        } else if (*p == ',' || *p == ')') {
+            keys.push_back(key);
+            key.clear();
+        } else {
+            key += *p;
+        }
+    }
+}
+
+const GAMSModelInstanceImpl::SolutionLayout &GAMSModelInstanceImpl::solutionLayout(const string &symbol)
+{
+    if (!mInstantiated)
+        throw GAMSException("Model instance " + mModelInstanceName + " not instantiated");
+    if (mSolutionLayouts.empty()) {
+        // the indices include the objective variable and row, a solver may leave the GMO with the
+        // objective as a function which drops them
+        gmoObjStyleSet(mGMO, gmoObjType_Var);
+        char buf[GMS_SSSIZE];
+        string name;
+        vector<string> keys;
+        for (int equation = 0; equation < 2; ++equation) {
+            const int count = equation ? gmoM(mGMO) : gmoN(mGMO);
+            for (int i = 0; i < count; ++i) {
+                if (equation)
+                    gmoGetEquNameOne(mGMO, i, buf);
+                else
+                    gmoGetVarNameOne(mGMO, i, buf);
+                splitSolutionName(buf, name, keys);
+                SolutionLayout &layout = mSolutionLayouts[name];
+                layout.equation = equation;
+                if (!layout.runs.empty() && layout.runs.back().first + layout.runs.back().second == i)
+                    layout.runs.back().second++;
+                else
+                    layout.runs.emplace_back(i, 1);
+                layout.keys.push_back(keys);
+            }
+        }
+    }
+    string lowerSymbol = symbol;
+    transform(lowerSymbol.begin(), lowerSymbol.end(), lowerSymbol.begin(), [](unsigned char c) { return char(tolower(c)); });
+    auto it = mSolutionLayouts.find(lowerSymbol);
+    if (it == mSolutionLayouts.end())
+        throw GAMSException("Model instance " + mModelInstanceName + " has no variable or equation " + symbol);
+    return it->second;
+}
+
+const vector<double> &GAMSModelInstanceImpl::solutionValues(int kind)
+{
+    vector<double> &values = mSolutionValues[kind];
+    if (!mSolutionValuesRead[kind]) {
+        // a solve may have changed the objective style since the layout has been built
+        if (gmoObjStyle(mGMO) != gmoObjType_Var)
+            gmoObjStyleSet(mGMO, gmoObjType_Var);
+        values.resize(kind < 2 ? gmoN(mGMO) : gmoM(mGMO));
+        switch (kind) {
+        case 0: gmoGetVarL(mGMO, values.data()); break;
+        case 1: gmoGetVarM(mGMO, values.data()); break;
+        case 2: gmoGetEquL(mGMO, values.data()); break;
+        default: gmoGetEquM(mGMO, values.data()); break;
+        }
+        mSolutionValuesRead[kind] = true;
+    }
+    return values;
+}
+
+void GAMSModelInstanceImpl::solutionChanged()
+{
+    fill(begin(mSolutionValuesRead), end(mSolutionValuesRead), false);
+}
+
+void GAMSModelInstanceImpl::recordSolveStats(const GAMSModelInstanceStats &stats)
+{
+    mLastSolveStats = stats;
+    if (mSolveStatsHistogram.empty())
+        resetSolveStatsHistogram();
+    for (int phase = 0; phase < GAMSModelInstanceStats::cPhaseCount; ++phase)
+        mSolveStatsHistogram[phase][GAMSWorkspaceImpl::jobStatsBucket(stats.time(GAMSModelInstanceStats::Phase(phase)))]++;
+}
+
+vector<int> GAMSModelInstanceImpl::solveStatsHistogram(GAMSModelInstanceStats::Phase phase) const
+{
+    if (mSolveStatsHistogram.empty())
+        return vector<int>(GAMSWorkspaceImpl::cJobStatsBuckets, 0);
+    return mSolveStatsHistogram[phase];
+}
+
+void GAMSModelInstanceImpl::resetSolveStatsHistogram()
+{
+    mSolveStatsHistogram.assign(GAMSModelInstanceStats::cPhaseCount, vector<int>(GAMSWorkspaceImpl::cJobStatsBuckets, 0));
+}
+
 }
@@ -28,15 +28,23 @@
 
 #include <string>
 #include <vector>
+#include <map>
+#include <cstdint>
+#include <chrono>
+#include <atomic>
 #include "gamsenum.h"
 #include "gamsoptions.h"
 #include "gamsmodelinstance.h"
+#include "gamsdatabaseimpl.h"
 #include "gamscheckpoint.h"
 #include "gevmcc.h"
 #include "gmomcc.h"
 #include "gmdcc.h"
 #include "gamspath.h"
 #include "gamsdatabase.h"
+#include "gamsbatchscenarios.h"
+#include "gamsbatchresults.h"
+#include "gamsmodelinstancestats.h"
 
 
 namespace gams {
@@ -78,8 +86,39 @@ public:
     /// Unlock syncDB record so user can add data for modifiers
     void dbLockSymbols();
 
+    /// Start tracking the modified records of a symbol of the sync database
+    void trackChanges(void *symPtr);
+    /// Get and reset the records of a symbol of the sync database modified since the last call
+    GAMSDatabaseImpl::SymbolChanges takeChanges(void *symPtr);
+    /// Mark a record of a symbol of the sync database as modified
+    void recordChanged(void *symPtr, const std::vector<std::string> &keys);
+
+    /// Mark the model instance as solving, solves must not overlap since they share the GMO and the
+    /// log of the instance. Throws if a synchronous or asynchronous solve is running already.
+    void startSolve();
+    /// Mark the solve as finished
+    void endSolve() { mSolving = false; }
+
     void instantiate(const std::string& modelDefinition, const GAMSOptions* options, const std::vector<GAMSModifier>& modifiers);
-    void solve(GAMSEnum::SymbolUpdateType updateType, std::ostream* output, GAMSModelInstanceOpt miOpt);
+    void solve(GAMSEnum::SymbolUpdateType updateType, std::ostream* output, GAMSModelInstanceOpt miOpt,
+               const GAMSModelInstance::SolverLogHandler &logHandler = nullptr,
+               std::chrono::milliseconds logInterval = std::chrono::milliseconds::zero());
+    void solveBatch(const GAMSBatchScenarios &scenarios, GAMSBatchResults &results,
+                    GAMSEnum::SymbolUpdateType updateType, const GAMSModelInstanceOpt &miOpt);
+
+    GAMSModelInstanceStats lastSolveStats() const { return mLastSolveStats; }
+    std::vector<int> solveStatsHistogram(GAMSModelInstanceStats::Phase phase) const;
+    void resetSolveStatsHistogram();
+
+    void saveSnapshot(const std::string &name);
+    void restoreSnapshot(const std::string &name);
+    void swapSnapshot(const std::string &name);
+    bool hasSnapshot(const std::string &name) const;
+    void removeSnapshot(const std::string &name);
+
+    int solutionRecords(const std::string &symbol);
+    std::vector<std::vector<std::string>> solutionKeys(const std::string &symbol);
+    void extractSolution(const std::string &symbol, double *levels, double *marginals);
 
 public:
     gevHandle_t mGEV;
@@ -89,9 +128,84 @@ public:
     GAMSDatabase mSyncDb;
 
 private:
+    /// Get the key of the instantiation cache of the workspace for the generated model and options
+    std::string instantiationCacheKey(const std::string &model, GAMSOptions &options);
+    /// Initialize the environment from a copy of a cached scratch directory
+    /// \return Returns <c>false</c> if the cached directory could not be copied.
+    bool initFromCachedScratchDir(const std::string &controlFile);
+    /// Keep a copy of the scratch directory of this freshly instantiated model instance
+    void cacheScratchDir(const std::string &cacheKey);
+
+    /// Primal/dual solution and basis of the model instance
+    struct SolutionSnapshot
+    {
+        std::vector<double> varLevels;
+        std::vector<double> varMarginals;
+        std::vector<int> varStats;
+        std::vector<double> equLevels;
+        std::vector<double> equMarginals;
+        std::vector<int> equStats;
+        bool haveBasis = false;
+    };
+    SolutionSnapshot currentSolution();
+    void loadSolution(const SolutionSnapshot &snapshot);
+    SolutionSnapshot &snapshot(const std::string &name);
+
+    /// Position of the records of a variable or equation in the GMO
+    struct SolutionLayout
+    {
+        bool equation = false;
+        /// Runs of consecutive GMO indices in record order as first index and length
+        std::vector<std::pair<int, int>> runs;
+        std::vector<std::vector<std::string>> keys;
+    };
+    /// Get the layout of a symbol, the layouts of all symbols are built from the dictionary on first use
+    const SolutionLayout &solutionLayout(const std::string &symbol);
+    /// Get the GMO values of one kind, read once after each solve or snapshot restore
+    const std::vector<double> &solutionValues(int kind);
+    /// Drop the values read from the GMO after its solution changed
+    void solutionChanged();
+
+    /// State of a modifier at its last update of the model instance
+    struct ModifierSync
+    {
+        /// Update type of the last update, -1 if the next update has to push all records
+        int updateType = -1;
+    };
+    /// Push the data of a modifier into the model instance: nothing if its data did not change, only
+    /// the modified records if possible, otherwise all records
+    /// \param noMatchCnt Number of unmatched records, -1 if the modifier has been skipped
+    /// \return Number of pushed records
+    int updateModifier(GAMSModifier &mod, ModifierSync &sync, int updateType,
+                       const GAMSDatabaseImpl::SymbolChanges &changes, int &noMatchCnt);
+    /// Get the private GMD pushing the modified records of modifiers, it is initialized from the
+    /// model instance on first use
+    gmdHandle_t deltaGmd();
+    /// Get the parameter of the private GMD receiving the modified records of modifiers of a dimension
+    void *deltaSymbol(int dim);
+    /// Get the symbol of the private GMD updating a model symbol
+    void *deltaModelSymbol(const std::string &name);
+
     GAMSPath mScrDir;
+    /// The scratch directory is outside of the working directory and removed with the model instance
+    bool mOwnScrDir = false;
     std::vector<GAMSModifier> mModifiers;
+    std::vector<ModifierSync> mModifierSync;
+    /// Keeps the modified records of modifiers out of SyncDB
+    gmdHandle_t mDeltaGMD = nullptr;
+    std::map<int, void*> mDeltaSymbols;
+    std::map<std::string, void*> mDeltaModelSymbols;
+    /// Keep the statistics of a solve and add its times to the histograms
+    void recordSolveStats(const GAMSModelInstanceStats &stats);
+    GAMSModelInstanceStats mLastSolveStats;
+    std::vector<std::vector<int>> mSolveStatsHistogram;
+    std::map<std::string, SolutionSnapshot> mSnapshots;
+    std::map<std::string, SolutionLayout> mSolutionLayouts;
+    /// Variable levels, variable marginals, equation levels and equation marginals of the GMO
+    std::vector<double> mSolutionValues[4];
+    bool mSolutionValuesRead[4] = {false, false, false, false};
     bool mInstantiated;
+    std::atomic<bool> mSolving{false};
     bool mLogAvailable;
     std::string mSelectedSolver = "";
     void solve(GAMSEnum::SymbolUpdateType updateType, std::string output, GAMSModelInstanceOpt miOpt);
@@ -63,4 +63,25 @@ void GAMSModelInstanceImpl::dbLockSymbols()
     mSyncDb.mImpl->lockSymbols();
 }
 
+void GAMSModelInstanceImpl::trackChanges(void *symPtr)
+{
+    if (!mSyncDb.isValid())
+        throw GAMSException("GAMSModelInstanceImpl: the database has not been initialized");
+    mSyncDb.mImpl->trackChanges(symPtr);
+}
+
+GAMSDatabaseImpl::SymbolChanges GAMSModelInstanceImpl::takeChanges(void *symPtr)
+{
+    if (!mSyncDb.isValid())
+        throw GAMSException("GAMSModelInstanceImpl: the database has not been initialized");
+    return mSyncDb.mImpl->takeChanges(symPtr);
+}
+
+void GAMSModelInstanceImpl::recordChanged(void *symPtr, const vector<string> &keys)
+{
+    if (!mSyncDb.isValid())
+        throw GAMSException("GAMSModelInstanceImpl: the database has not been initialized");
+    mSyncDb.mImpl->recordChanged(symPtr, keys);
+}
+
 }
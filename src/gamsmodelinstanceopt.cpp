@@ -94,4 +94,34 @@ void GAMSModelInstanceOpt::setDebug(const bool debug)
     mImpl->mDebug = debug;
 }
 
+string GAMSModelInstanceOpt::startSnapshot()
+{
+    return mImpl->mStartSnapshot;
+}
+
+void GAMSModelInstanceOpt::setStartSnapshot(const string& name)
+{
+    mImpl->mStartSnapshot = name;
+}
+
+string GAMSModelInstanceOpt::resultSnapshot()
+{
+    return mImpl->mResultSnapshot;
+}
+
+void GAMSModelInstanceOpt::setResultSnapshot(const string& name)
+{
+    mImpl->mResultSnapshot = name;
+}
+
+bool GAMSModelInstanceOpt::startSnapshotOverridesUpdate()
+{
+    return mImpl->mStartSnapshotOverridesUpdate;
+}
+
+void GAMSModelInstanceOpt::setStartSnapshotOverridesUpdate(const bool overrides)
+{
+    mImpl->mStartSnapshotOverridesUpdate = overrides;
+}
+
 } // namespace gams
@@ -99,6 +99,34 @@ public:
     /// \param debug <c>true</c> if the convert solver is called; otherwise <c>false</c>.
     void setDebug(const bool debug);
 
+    /// Get the name of the snapshot used as start point of the solve.
+    /// \return Returns the snapshot name or an empty string if the solve starts from the current solution.
+    std::string startSnapshot();
+
+    /// Set the name of a snapshot (see GAMSModelInstance::saveSnapshot) that is restored before the solve
+    /// to warm-start the solver with its primal/dual solution and basis.
+    /// \param name Snapshot name; an empty string starts from the current solution of the model instance.
+    void setStartSnapshot(const std::string& name);
+
+    /// Get the name of the snapshot that receives the solution after the solve.
+    std::string resultSnapshot();
+
+    /// Set the name of a snapshot that receives the primal/dual solution and basis after the solve.
+    /// \param name Snapshot name; an empty string does not store the solution.
+    void setResultSnapshot(const std::string& name);
+
+    /// Get whether the start snapshot overrides level and marginal modifiers.
+    bool startSnapshotOverridesUpdate();
+
+    /// Set whether the start snapshot overrides level and marginal modifiers.
+    /// \remark By default the start snapshot is restored before the modifiers are applied. Primal and dual
+    ///         modifiers with update type Accumulate then only change the records they supply and keep the
+    ///         snapshot values for all others, while BaseCase and Zero reset the missing records. If set to
+    ///         <c>true</c> the snapshot is restored after the modifiers and all levels and marginals come
+    ///         from the snapshot.
+    /// \param overrides <c>true</c> to restore the snapshot after the modifiers; otherwise <c>false</c>.
+    void setStartSnapshotOverridesUpdate(const bool overrides);
+
 private:
     std::shared_ptr<GAMSModelInstanceOptImpl> mImpl;
 };
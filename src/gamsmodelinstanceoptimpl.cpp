@@ -40,7 +40,9 @@ GAMSModelInstanceOptImpl::GAMSModelInstanceOptImpl(std::string solver,
 bool GAMSModelInstanceOptImpl::operator!=(const GAMSModelInstanceOptImpl& other) const
 {
     return (mSolver != other.mSolver) || (mOptFile != other.mOptFile)
-            || (mNoMatchLimit != other.mNoMatchLimit) || (mDebug != other.mDebug);
+            || (mNoMatchLimit != other.mNoMatchLimit) || (mDebug != other.mDebug)
+            || (mStartSnapshot != other.mStartSnapshot) || (mResultSnapshot != other.mResultSnapshot)
+            || (mStartSnapshotOverridesUpdate != other.mStartSnapshotOverridesUpdate);
 
 }
 
@@ -42,6 +42,9 @@ public:
     int mOptFile;
     int mNoMatchLimit;
     bool mDebug;
+    std::string mStartSnapshot;
+    std::string mResultSnapshot;
+    bool mStartSnapshotOverridesUpdate = false;
 };
 
 } // namespace gams
@@ -0,0 +1,114 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSMODELINSTANCEPOOL_H
+#define GAMSMODELINSTANCEPOOL_H
+
+#include "gamslib_global.h"
+#include <memory>
+#include <vector>
+#include <functional>
+#include <type_traits>
+
+namespace gams {
+
+class GAMSModelInstance;
+class GAMSModelInstancePoolImpl;
+
+/// <p>The GAMSModelInstancePool solves many scenarios of one model instance in parallel. It
+/// is created from an instantiated GAMSModelInstance and copies it (see
+/// GAMSModelInstance::copyModelInstance) once for each worker thread of the pool. The source
+/// instance is only used for copying and must not be solved while the pool exists.</p>
+/// <p>A scenario is a callback that receives the model instance of the worker running it and
+/// the index of the scenario. It typically sets the modifier data in the syncDb, calls solve
+/// and returns the results of interest. Scenarios are handed out to the workers one by one, so
+/// long and short scenarios are balanced automatically, and the results are collected by
+/// scenario index without any locking in the callback.</p>
+/// <p>A scenario throwing an exception may have left its model instance in an undefined state.
+/// The instance is therefore replaced by a fresh copy of the source and the scenario is tried
+/// once more. If it fails again, the remaining scenarios are still solved and the exception
+/// is rethrown afterwards.</p>
+class LIBSPEC GAMSModelInstancePool
+{
+public:
+    /// Callback solving one scenario.
+    typedef std::function<void(GAMSModelInstance& mi, int scenario)> Scenario;
+
+    /// Constructor.
+    /// \param source Instantiated GAMSModelInstance copied for every worker.
+    /// \param workers Number of worker threads (number of hardware threads if not positive).
+    GAMSModelInstancePool(const GAMSModelInstance &source, int workers = 0);
+
+    /// Destructor. Waits for the worker threads to end.
+    ~GAMSModelInstancePool();
+
+    /// Get the number of worker threads.
+    int numberOfWorkers() const;
+
+    /// Solve scenarios on the worker threads and wait until all of them have been processed.
+    /// \param count Number of scenarios; the callback is called for the indices <c>0</c> to <c>count-1</c>.
+    /// \param scenario Callback solving one scenario.
+    void run(int count, const Scenario &scenario);
+
+    /// Solve scenarios on the worker threads and collect their results.
+    /// \param count Number of scenarios; the callback is called for the indices <c>0</c> to <c>count-1</c>.
+    /// \param scenario Callback solving one scenario and returning its result.
+    /// \return Returns the results ordered by scenario index.
+    template<typename Result>
+    std::vector<Result> run(int count, const std::function<Result(GAMSModelInstance&, int)> &scenario)
+    {
+        // the elements of std::vector<bool> share memory and cannot be written by several threads
+        static_assert(!std::is_same<Result, bool>::value, "GAMSModelInstancePool: use char instead of bool results");
+        std::vector<Result> results(count > 0 ? count : 0);
+        run(count, Scenario([&results, &scenario](GAMSModelInstance &mi, int index) {
+            results[index] = scenario(mi, index);
+        }));
+        return results;
+    }
+
+    /// Get the number of scenarios solved successfully.
+    long long scenariosSolved() const;
+
+    /// Get the number of scenarios that failed, also after a retry with a fresh model instance.
+    long long scenariosFailed() const;
+
+    /// Get the number of model instances replaced after a failing scenario.
+    /// \remark A failed instance is replaced when its worker starts the next attempt or scenario.
+    long long instancesReplaced() const;
+
+    /// Get the number of scenarios processed per second while scenarios were running.
+    double throughput() const;
+
+    /// Get the fraction of the time the workers were busy while scenarios were running.
+    /// \return Returns a value between <c>0</c> and <c>1</c>.
+    double utilization() const;
+
+private:
+    std::shared_ptr<GAMSModelInstancePoolImpl> mImpl;
+};
+
+} // namespace gams
+
+#endif // GAMSMODELINSTANCEPOOL_H
@@ -0,0 +1,182 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsmodelinstancepoolimpl.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSModelInstancePoolImpl::GAMSModelInstancePoolImpl(const GAMSModelInstance &source, int workers)
+    : mSource(source)
+{
+    if (!mSource.isValid())
+        throw GAMSException("GAMSModelInstancePool: The source model instance has not been initialized.");
+    if (workers <= 0)
+        workers = max(1, static_cast<int>(thread::hardware_concurrency()));
+    for (int i = 0; i < workers; ++i)
+        mInstances.push_back(copySource());
+    mFailedInstances.assign(mInstances.size(), false);
+    for (size_t i = 0; i < mInstances.size(); ++i)
+        mThreads.emplace_back(&GAMSModelInstancePoolImpl::work, this, i);
+}
+
+GAMSModelInstancePoolImpl::~GAMSModelInstancePoolImpl()
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        mShutdown = true;
+    }
+    mHasWork.notify_all();
+    for (thread &t : mThreads)
+        t.join();
+}
+
+GAMSModelInstance GAMSModelInstancePoolImpl::copySource()
+{
+    // copying reads the syncDb and the scratch directory of the source
+    lock_guard<mutex> lck(mCopyLock);
+    return mSource.copyModelInstance();
+}
+
+void GAMSModelInstancePoolImpl::run(int count, const GAMSModelInstancePool::Scenario &scenario)
+{
+    if (count <= 0)
+        return;
+    lock_guard<mutex> runLck(mRunLock);
+    auto start = chrono::steady_clock::now();
+    {
+        lock_guard<mutex> lck(mLock);
+        mScenario = &scenario;
+        mCount = count;
+        mNext = 0;
+        mPending = count;
+        mError = nullptr;
+    }
+    mHasWork.notify_all();
+
+    exception_ptr error;
+    {
+        unique_lock<mutex> lck(mLock);
+        mBatchDone.wait(lck, [this] { return mPending == 0; });
+        mScenario = nullptr;
+        mCount = 0;
+        mNext = 0;
+        error = mError;
+        mError = nullptr;
+        mRunTime += chrono::steady_clock::now() - start;
+    }
+    if (error)
+        rethrow_exception(error);
+}
+
+void GAMSModelInstancePoolImpl::work(size_t worker)
+{
+    unique_lock<mutex> lck(mLock);
+    while (true) {
+        mHasWork.wait(lck, [this] { return mShutdown || mNext < mCount; });
+        if (mShutdown)
+            return;
+        int index = mNext++;
+        const GAMSModelInstancePool::Scenario &scenario = *mScenario;
+        lck.unlock();
+
+        auto start = chrono::steady_clock::now();
+        bool solved = false;
+        int replaced = 0;
+        exception_ptr error;
+        for (int attempt = 0; attempt < 2 && !solved; ++attempt) {
+            // a failed instance is only replaced when a scenario is going to use it
+            if (mFailedInstances[worker]) {
+                try {
+                    mInstances[worker] = copySource();
+                    mFailedInstances[worker] = false;
+                    replaced++;
+                } catch (...) {
+                    // keep the old instance, the next scenario tries again
+                    if (!error)
+                        error = current_exception();
+                    break;
+                }
+            }
+            try {
+                scenario(mInstances[worker], index);
+                solved = true;
+            } catch (...) {
+                error = current_exception();
+                mFailedInstances[worker] = true;
+            }
+        }
+        auto busy = chrono::steady_clock::now() - start;
+
+        lck.lock();
+        mBusyTime += busy;
+        mReplaced += replaced;
+        if (solved) {
+            mSolved++;
+        } else {
+            mFailed++;
+            if (!mError)
+                mError = error;
+        }
+        if (--mPending == 0)
+            mBatchDone.notify_all();
+    }
+}
+
+long long GAMSModelInstancePoolImpl::scenariosSolved()
+{
+    lock_guard<mutex> lck(mLock);
+    return mSolved;
+}
+
+long long GAMSModelInstancePoolImpl::scenariosFailed()
+{
+    lock_guard<mutex> lck(mLock);
+    return mFailed;
+}
+
+long long GAMSModelInstancePoolImpl::instancesReplaced()
+{
+    lock_guard<mutex> lck(mLock);
+    return mReplaced;
+}
+
+double GAMSModelInstancePoolImpl::throughput()
+{
+    lock_guard<mutex> lck(mLock);
+    double seconds = chrono::duration<double>(mRunTime).count();
+    return seconds > 0 ? (mSolved + mFailed) / seconds : 0.0;
+}
+
+double GAMSModelInstancePoolImpl::utilization()
+{
+    lock_guard<mutex> lck(mLock);
+    double capacity = chrono::duration<double>(mRunTime).count() * mInstances.size();
+    return capacity > 0 ? min(1.0, chrono::duration<double>(mBusyTime).count() / capacity) : 0.0;
+}
+
+} // namespace gams
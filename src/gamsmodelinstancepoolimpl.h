@@ -0,0 +1,91 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSMODELINSTANCEPOOLIMPL_H
+#define GAMSMODELINSTANCEPOOLIMPL_H
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "gamsmodelinstance.h"
+#include "gamsmodelinstancepool.h"
+
+namespace gams {
+
+class GAMSModelInstancePoolImpl
+{
+public:
+    GAMSModelInstancePoolImpl(const GAMSModelInstance &source, int workers);
+    ~GAMSModelInstancePoolImpl();
+
+    void run(int count, const GAMSModelInstancePool::Scenario &scenario);
+
+    int numberOfWorkers() const { return static_cast<int>(mInstances.size()); }
+    long long scenariosSolved();
+    long long scenariosFailed();
+    long long instancesReplaced();
+    double throughput();
+    double utilization();
+
+private:
+    /// Loop of a worker thread, the model instance of a worker is only used by its thread
+    void work(size_t worker);
+    /// Copy the source model instance, copies are made one at a time
+    GAMSModelInstance copySource();
+
+    GAMSModelInstance mSource;
+    std::mutex mCopyLock;
+    std::vector<GAMSModelInstance> mInstances;
+    /// The instance of a worker failed and is replaced before it solves the next scenario, only
+    /// accessed by the worker
+    std::vector<char> mFailedInstances;
+    std::vector<std::thread> mThreads;
+
+    /// Serializes calls of run
+    std::mutex mRunLock;
+
+    std::mutex mLock;
+    std::condition_variable mHasWork;
+    std::condition_variable mBatchDone;
+    const GAMSModelInstancePool::Scenario *mScenario = nullptr;
+    int mCount = 0;
+    int mNext = 0;
+    int mPending = 0;
+    bool mShutdown = false;
+    std::exception_ptr mError;
+
+    long long mSolved = 0;
+    long long mFailed = 0;
+    long long mReplaced = 0;
+    std::chrono::nanoseconds mBusyTime = std::chrono::nanoseconds::zero();
+    std::chrono::nanoseconds mRunTime = std::chrono::nanoseconds::zero();
+};
+
+} // namespace gams
+
+#endif // GAMSMODELINSTANCEPOOLIMPL_H
@@ -0,0 +1,75 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSMODELINSTANCESTATS_H
+#define GAMSMODELINSTANCESTATS_H
+
+#include "gamslib_global.h"
+#include <chrono>
+#include <string>
+
+namespace gams {
+
+/// Timings and counts of the phases of one GAMSModelInstance solve.
+struct LIBSPEC GAMSModelInstanceStats
+{
+    /// Phases of a GAMSModelInstance solve
+    enum Phase
+    {
+        Update = 0,     ///< Update of the model with the modifier data (gmdInitUpdate and gmdUpdateModelSymbol)
+        Solver,         ///< Resource usage reported by the solver
+        Sync,           ///< Rest of the solver call: passing the model to the solver and the solution back into the sync database
+        Log,            ///< Redirecting the solver log and passing it to the output
+        Total           ///< Sum of all phases
+    };
+
+    /// Number of phases including Total
+    static const int cPhaseCount = Total + 1;
+
+    /// Get the time spent in a phase.
+    /// \param phase The phase.
+    /// \return Returns the time spent in the phase.
+    std::chrono::nanoseconds time(Phase phase) const;
+
+    /// Get the name of a phase.
+    /// \param phase The phase.
+    /// \return Returns the name of the phase.
+    static std::string text(Phase phase);
+
+    std::chrono::nanoseconds updateTime = std::chrono::nanoseconds::zero();     ///< Time of phase Update
+    std::chrono::nanoseconds solverTime = std::chrono::nanoseconds::zero();     ///< Time of phase Solver
+    std::chrono::nanoseconds syncTime = std::chrono::nanoseconds::zero();       ///< Time of phase Sync
+    std::chrono::nanoseconds logTime = std::chrono::nanoseconds::zero();        ///< Time of phase Log
+
+    int updatedRecords = 0;     ///< Number of data records pushed into the model
+    int skippedModifiers = 0;   ///< Number of modifiers not updated because their data did not change
+    int unmatchedRecords = 0;   ///< Number of data records without a match in the model
+    int iterations = 0;         ///< Iterations reported by the solver
+    double nodes = 0;           ///< Branch and bound nodes reported by the solver
+};
+
+} // namespace gams
+
+#endif // GAMSMODELINSTANCESTATS_H
@@ -0,0 +1,92 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsnameregistry.h"
+#include <functional>
+
+using namespace std;
+
+namespace gams {
+
+GAMSNameRegistry::GAMSNameRegistry(const string &stem)
+    : mStem(stem)
+{}
+
+string GAMSNameRegistry::add(const string &name, const string &prefix)
+{
+    if (!name.empty()) {
+        skipDefaultName(name, prefix);
+        return insert(name) ? name : string();
+    }
+    // a default name can only be taken if it was registered explicitly before
+    string defName;
+    do {
+        defName = prefix + mStem + to_string(mCounter.fetch_add(1, memory_order_relaxed));
+    } while (!insert(defName));
+    return defName;
+}
+
+string GAMSNameRegistry::next(const string &prefix)
+{
+    string defName;
+    do {
+        defName = prefix + mStem + to_string(mCounter.fetch_add(1, memory_order_relaxed));
+    } while (contains(defName));
+    return defName;
+}
+
+GAMSNameRegistry::Shard &GAMSNameRegistry::shard(const string &name)
+{
+    return mShards[hash<string>()(name) % cShards];
+}
+
+bool GAMSNameRegistry::contains(const string &name)
+{
+    Shard &s = shard(name);
+    lock_guard<mutex> lck(s.lock);
+    return s.names.count(name) > 0;
+}
+
+bool GAMSNameRegistry::insert(const string &name)
+{
+    Shard &s = shard(name);
+    lock_guard<mutex> lck(s.lock);
+    return s.names.insert(name).second;
+}
+
+void GAMSNameRegistry::skipDefaultName(const string &name, const string &prefix)
+{
+    const string defPrefix = prefix + mStem;
+    if (name.size() <= defPrefix.size() || name.compare(0, defPrefix.size(), defPrefix) != 0
+            || name.size() - defPrefix.size() > 18
+            || name.find_first_not_of("0123456789", defPrefix.size()) != string::npos)
+        return;
+    unsigned long long number = stoull(name.substr(defPrefix.size()));
+    unsigned long long counter = mCounter.load(memory_order_relaxed);
+    while (counter <= number && !mCounter.compare_exchange_weak(counter, number + 1, memory_order_relaxed))
+        ;
+}
+
+} // namespace gams
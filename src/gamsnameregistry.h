@@ -0,0 +1,79 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSNAMEREGISTRY_H
+#define GAMSNAMEREGISTRY_H
+
+#include <string>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+
+namespace gams {
+
+/// Thread-safe registry of the names of one kind of workspace objects.
+/// Default names are drawn from an atomic counter, registered names are kept in
+/// hash sets sharded by name so that concurrent registrations rarely share a lock.
+class GAMSNameRegistry
+{
+public:
+    /// Constructor
+    /// \param stem Stem of the default names, which are prefix + stem + counter.
+    GAMSNameRegistry(const std::string &stem);
+
+    /// Register a name.
+    /// \param name Name to register (empty: generate default name).
+    /// \param prefix Prefix of the default names.
+    /// \return Returns the registered name, or an empty string if the name is already registered.
+    std::string add(const std::string &name, const std::string &prefix);
+
+    /// Get a default name that is not registered, without registering it.
+    /// \param prefix Prefix of the default names.
+    std::string next(const std::string &prefix);
+
+private:
+    static const size_t cShards = 16;
+
+    struct Shard
+    {
+        std::mutex lock;
+        std::unordered_set<std::string> names;
+    };
+
+    Shard &shard(const std::string &name);
+    bool contains(const std::string &name);
+    bool insert(const std::string &name);
+    /// Keep default names of this registry ahead of an explicitly registered name that looks like one
+    void skipDefaultName(const std::string &name, const std::string &prefix);
+
+    std::string mStem;
+    std::atomic<unsigned long long> mCounter { 0 };
+    std::array<Shard, cShards> mShards;
+};
+
+} // namespace gams
+
+#endif // GAMSNAMEREGISTRY_H
@@ -29,6 +29,8 @@
 #include <direct.h>
 #include <wchar.h>
 #pragma comment(lib, "advapi32")
+#else
+#include <signal.h>
 #endif
 
 #include "gamsplatform.h"
@@ -38,6 +40,8 @@
 #include <sstream>
 #include <array>
 #include <thread>
+#include <iomanip>
+#include <cstdint>
 
 #include "gamspath.h"
 #include "gamsenum.h"
@@ -184,9 +188,11 @@ void GAMSPlatform::ensureEnvPathSetOnApple(const char *dirName)
 
 bool GAMSPlatform::interruptOnNonWindows(long pid)
 {
-    string result;
-    runProcess("", "/bin/bash", "-c -kill -2 " + to_string(pid), result);
-    return true;
+#ifndef _WIN32
+    return ::kill(static_cast<pid_t>(pid), SIGINT) == 0;
+#else
+    throw GAMSException("interruptOnNonWindows not impemented on Windows");
+#endif
 }
 
 string GAMSPlatform::findGamsOnWindows(LogId logId)
@@ -334,4 +340,17 @@ thread GAMSPlatform::runProcessParallel(const string &executable, const string &
     return t;
 }
 
+string GAMSPlatform::contentHash(const string &data)
+{
+    // 64 bit FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    ostringstream res;
+    res << hex << setw(16) << setfill('0') << hash;
+    return res.str();
+}
+
 } // namespace gams
@@ -59,8 +59,7 @@ struct LIBSPEC GAMSPlatform
     /// \param pid A process ID.
     /// \return Returns <c>true</c> if the interrupt was called successfully;
     ///         otherwise <c>false</c>.
-    /// \remark On unix like platfoms this function calls gams to execute
-    ///         the interrupt and waits unitl gams has finished.
+    /// \remark On unix like platfoms this function sends SIGINT to the process.
     static bool interrupt(long pid);
 
     ///
@@ -84,6 +83,14 @@ struct LIBSPEC GAMSPlatform
     ///
     static std::thread runProcessParallel(const std::string &executable, const std::string &args);
 
+    ///
+    /// Hashes data to name files after their content. Unlike std::hash the result is the same
+    /// on all platforms and builds, so files named after it can be reused by other processes.
+    /// \param data Data to hash.
+    /// \return Hash value as hexadecimal string.
+    ///
+    static std::string contentHash(const std::string &data);
+
 private:
     GAMSPlatform() {}
 
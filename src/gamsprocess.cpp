@@ -0,0 +1,324 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <crt_externs.h>
+#define environ (*_NSGetEnviron())
+#else
+extern char **environ;
+#endif
+#endif
+
+#include <array>
+#include <cstring>
+#include "gamsprocess.h"
+#include "gamsexception.h"
+#include "gamsplatform.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSProcess::GAMSProcess(const string &program, const vector<string> &arguments)
+    : mProgram(program), mArguments(arguments)
+{}
+
+GAMSProcess::~GAMSProcess()
+{
+    if (pid())
+        wait();
+    closeOutput();
+}
+
+long GAMSProcess::pid() const
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid;
+}
+
+string GAMSProcess::commandLine() const
+{
+    string cmd = "\"" + mProgram + "\"";
+    for (const string &arg : mArguments) {
+        if (arg.empty() || arg.find_first_of(" \t") != string::npos)
+            cmd += " \"" + arg + "\"";
+        else
+            cmd += " " + arg;
+    }
+    return cmd;
+}
+
+#ifdef _WIN32
+
+void GAMSProcess::start()
+{
+    SECURITY_ATTRIBUTES sa;
+    sa.nLength = sizeof(SECURITY_ATTRIBUTES);
+    sa.bInheritHandle = TRUE;
+    sa.lpSecurityDescriptor = nullptr;
+
+    HANDLE readEnd, writeEnd;
+    if (!CreatePipe(&readEnd, &writeEnd, &sa, 0))
+        throw GAMSException("GAMSProcess: could not create output pipe for " + mProgram);
+    SetHandleInformation(readEnd, HANDLE_FLAG_INHERIT, 0);
+
+    STARTUPINFOA si;
+    ZeroMemory(&si, sizeof(si));
+    si.cb = sizeof(si);
+    si.dwFlags = STARTF_USESTDHANDLES;
+    si.hStdInput = GetStdHandle(STD_INPUT_HANDLE);
+    si.hStdOutput = writeEnd;
+    si.hStdError = GetStdHandle(STD_ERROR_HANDLE);
+
+    PROCESS_INFORMATION pi;
+    ZeroMemory(&pi, sizeof(pi));
+    string cmd = commandLine();
+    vector<char> cmdBuffer(cmd.begin(), cmd.end());
+    cmdBuffer.push_back('\0');
+
+    BOOL started = CreateProcessA(nullptr, cmdBuffer.data(), nullptr, nullptr, TRUE, 0,
+                                  nullptr, nullptr, &si, &pi);
+    CloseHandle(writeEnd);
+    if (!started) {
+        CloseHandle(readEnd);
+        throw GAMSException("GAMSProcess: couldn't start command: " + cmd);
+    }
+    CloseHandle(pi.hThread);
+    mProcessHandle = pi.hProcess;
+    mOutput = readEnd;
+    lock_guard<mutex> lck(mPidLock);
+    mPid = static_cast<long>(pi.dwProcessId);
+}
+
+size_t GAMSProcess::read(char *buffer, size_t size)
+{
+    if (!mOutput)
+        return 0;
+    DWORD bytesRead = 0;
+    if (!ReadFile(static_cast<HANDLE>(mOutput), buffer, static_cast<DWORD>(size), &bytesRead, nullptr))
+        return 0;
+    return bytesRead;
+}
+
+bool GAMSProcess::waitForReadyRead(int msecs)
+{
+    if (!mOutput)
+        return true;
+    DWORD start = GetTickCount();
+    while (true) {
+        DWORD available = 0;
+        if (!PeekNamedPipe(static_cast<HANDLE>(mOutput), nullptr, 0, nullptr, &available, nullptr) || available > 0)
+            return true;
+        if (msecs >= 0 && GetTickCount() - start >= static_cast<DWORD>(msecs))
+            return false;
+        Sleep(10);
+    }
+}
+
+bool GAMSProcess::interrupt()
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid && GAMSPlatform::interrupt(mPid);
+}
+
+bool GAMSProcess::terminate()
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid && TerminateProcess(static_cast<HANDLE>(mProcessHandle), 1);
+}
+
+bool GAMSProcess::kill()
+{
+    return terminate();
+}
+
+int GAMSProcess::wait()
+{
+    if (!pid())
+        return -1;
+    array<char, 4096> buffer;
+    while (read(buffer.data(), buffer.size()) > 0) {}
+
+    WaitForSingleObject(static_cast<HANDLE>(mProcessHandle), INFINITE);
+    DWORD exitCode = 0;
+    GetExitCodeProcess(static_cast<HANDLE>(mProcessHandle), &exitCode);
+    {
+        lock_guard<mutex> lck(mPidLock);
+        CloseHandle(static_cast<HANDLE>(mProcessHandle));
+        mProcessHandle = nullptr;
+        mPid = 0;
+    }
+    closeOutput();
+    return static_cast<int>(exitCode);
+}
+
+void GAMSProcess::closeOutput()
+{
+    if (mOutput) {
+        CloseHandle(static_cast<HANDLE>(mOutput));
+        mOutput = nullptr;
+    }
+}
+
+#else // ! _WIN32
+
+void GAMSProcess::start()
+{
+    int fds[2];
+#ifdef __linux__
+    // O_CLOEXEC keeps the pipe out of processes spawned concurrently by other threads
+    if (pipe2(fds, O_CLOEXEC) != 0)
+        throw GAMSException("GAMSProcess: could not create output pipe for " + mProgram);
+#else
+    if (pipe(fds) != 0)
+        throw GAMSException("GAMSProcess: could not create output pipe for " + mProgram);
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+
+    // run in an own process group, so terminate() and kill() also reach the solvers started by GAMS
+    posix_spawnattr_t attr;
+    posix_spawnattr_init(&attr);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attr, 0);
+
+    vector<char*> argv;
+    argv.push_back(const_cast<char*>(mProgram.c_str()));
+    for (const string &arg : mArguments)
+        argv.push_back(const_cast<char*>(arg.c_str()));
+    argv.push_back(nullptr);
+
+    pid_t pid = 0;
+    int rc = posix_spawn(&pid, mProgram.c_str(), &actions, &attr, argv.data(), environ);
+    posix_spawnattr_destroy(&attr);
+    posix_spawn_file_actions_destroy(&actions);
+    close(fds[1]);
+    if (rc != 0) {
+        close(fds[0]);
+        throw GAMSException("GAMSProcess: couldn't start command: " + commandLine() + " (" + strerror(rc) + ")");
+    }
+    mOutput = fds[0];
+    lock_guard<mutex> lck(mPidLock);
+    mPid = static_cast<long>(pid);
+}
+
+size_t GAMSProcess::read(char *buffer, size_t size)
+{
+    if (mOutput < 0)
+        return 0;
+    ssize_t n;
+    do {
+        n = ::read(mOutput, buffer, size);
+    } while (n < 0 && errno == EINTR);
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+bool GAMSProcess::waitForReadyRead(int msecs)
+{
+    if (mOutput < 0)
+        return true;
+    pollfd pfd;
+    pfd.fd = mOutput;
+    pfd.events = POLLIN;
+    pfd.revents = 0;
+    int rc;
+    do {
+        rc = poll(&pfd, 1, msecs);
+    } while (rc < 0 && errno == EINTR);
+    return rc != 0;
+}
+
+bool GAMSProcess::interrupt()
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid && GAMSPlatform::interrupt(mPid);
+}
+
+bool GAMSProcess::terminate()
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid && ::kill(-static_cast<pid_t>(mPid), SIGTERM) == 0;
+}
+
+bool GAMSProcess::kill()
+{
+    lock_guard<mutex> lck(mPidLock);
+    return mPid && ::kill(-static_cast<pid_t>(mPid), SIGKILL) == 0;
+}
+
+int GAMSProcess::wait()
+{
+    pid_t pid = static_cast<pid_t>(this->pid());
+    if (!pid)
+        return -1;
+    // drain the pipe, otherwise a process writing a lot of output never terminates
+    array<char, 4096> buffer;
+    while (read(buffer.data(), buffer.size()) > 0) {}
+
+    {
+        lock_guard<mutex> lck(mPidLock);
+        mPid = 0;
+    }
+    int status = 0;
+    pid_t rc;
+    do {
+        rc = waitpid(pid, &status, 0);
+    } while (rc < 0 && errno == EINTR);
+    closeOutput();
+
+    if (rc < 0)
+        return -1;
+    if (WIFEXITED(status))
+        return WEXITSTATUS(status);
+    if (WIFSIGNALED(status))
+        return 128 + WTERMSIG(status);
+    return -1;
+}
+
+void GAMSProcess::closeOutput()
+{
+    if (mOutput >= 0) {
+        close(mOutput);
+        mOutput = -1;
+    }
+}
+
+#endif // ! _WIN32
+
+} // namespace gams
@@ -0,0 +1,110 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSPROCESS_H
+#define GAMSPROCESS_H
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+namespace gams {
+
+/// Runs an executable directly (without a shell in between) and gives access to its
+/// standard output through a pipe while the process is running.
+class GAMSProcess
+{
+public:
+    /// Constructor.
+    /// \param program Path of the executable to run.
+    /// \param arguments Arguments passed to the executable (without the program name).
+    GAMSProcess(const std::string &program, const std::vector<std::string> &arguments);
+
+    /// Destructor. Waits for a still running process to terminate.
+    ~GAMSProcess();
+
+    GAMSProcess(const GAMSProcess&) = delete;
+    GAMSProcess& operator=(const GAMSProcess&) = delete;
+
+    /// Start the process.
+    /// \remark Throws a GAMSException if the process could not be started.
+    void start();
+
+    /// Get the process ID of the started process.
+    /// \return Returns the process ID or <c>0</c> if the process is not running.
+    long pid() const;
+
+#ifndef _WIN32
+    /// Get the file descriptor of the read end of the output pipe, e.g. to poll it.
+    int outputDescriptor() const { return mOutput; }
+#endif
+
+    /// Read the next chunk of the process output. Blocks until data is available.
+    /// \param buffer Buffer to receive the data.
+    /// \param size Size of the buffer.
+    /// \return Returns the number of bytes read or <c>0</c> if the output has been closed.
+    std::size_t read(char *buffer, std::size_t size);
+
+    /// Wait until output is available for reading or the output has been closed.
+    /// \param msecs Maximum time to wait in milliseconds (<c>-1</c> waits without limit).
+    /// \return Returns <c>true</c> if a subsequent read does not block; otherwise <c>false</c>.
+    bool waitForReadyRead(int msecs);
+
+    /// Wait for the process to terminate.
+    /// \return Returns the exit code of the process.
+    int wait();
+
+    /// Ask the process to interrupt, which is the same as pressing Ctrl+C for GAMS.
+    /// \return Returns <c>true</c> if the signal was delivered; otherwise <c>false</c>.
+    bool interrupt();
+
+    /// Ask the process and all processes started by it to terminate (SIGTERM).
+    /// \return Returns <c>true</c> if the signal was delivered; otherwise <c>false</c>.
+    bool terminate();
+
+    /// Kill the process and all processes started by it (SIGKILL).
+    /// \return Returns <c>true</c> if the signal was delivered; otherwise <c>false</c>.
+    bool kill();
+
+private:
+    std::string commandLine() const;
+    void closeOutput();
+
+    std::string mProgram;
+    std::vector<std::string> mArguments;
+    // guards mPid, the PID is reset before the process is reaped so it can't be reused while signaled
+    mutable std::mutex mPidLock;
+    long mPid = 0;
+#ifdef _WIN32
+    void *mProcessHandle = nullptr;
+    void *mOutput = nullptr;
+#else
+    int mOutput = -1;
+#endif
+};
+
+} // namespace gams
+
+#endif // GAMSPROCESS_H
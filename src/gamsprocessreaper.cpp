@@ -0,0 +1,303 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include "gamsprocessreaper.h"
+#include "gamsprocess.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+// grace period between the escalation steps SIGINT -> SIGTERM -> SIGKILL
+static const chrono::milliseconds cEscalationGrace(250);
+// threads passing output and exit status to the callbacks of the watches
+static const int cCallbackThreads = 4;
+// buffered output of a process at which the reaper stops reading it
+static const size_t cMaxBufferedOutput = 1 << 20;
+
+GAMSProcessReaper& GAMSProcessReaper::instance()
+{
+    // intentionally never destroyed, the reaper thread runs until the application exits
+    static GAMSProcessReaper *reaper = new GAMSProcessReaper();
+    return *reaper;
+}
+
+GAMSProcessReaper::GAMSProcessReaper()
+{
+#ifndef _WIN32
+    if (pipe(mWakeUp) != 0)
+        throw GAMSException("GAMSProcessReaper: could not create wake-up pipe");
+    for (int fd : mWakeUp) {
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    }
+#endif
+    thread(&GAMSProcessReaper::run, this).detach();
+    for (int i = 0; i < cCallbackThreads; ++i)
+        thread(&GAMSProcessReaper::runCallbacks, this).detach();
+}
+
+void GAMSProcessReaper::watch(const shared_ptr<GAMSProcess> &process, const OutputHandler &onOutput,
+                              const FinishedHandler &onFinished, chrono::milliseconds timeLimit,
+                              const ReadyHandler &readyForOutput)
+{
+    auto watch = make_shared<Watch>();
+    watch->mProcess = process;
+    watch->mOnOutput = onOutput;
+    watch->mOnFinished = onFinished;
+    watch->mReadyForOutput = readyForOutput;
+    if (timeLimit > chrono::milliseconds::zero())
+        watch->mNextEscalation = chrono::steady_clock::now() + timeLimit;
+    else
+        watch->mNextEscalation = chrono::steady_clock::time_point::max();
+    {
+        lock_guard<mutex> lck(mLock);
+        mWatches.push_back(watch);
+    }
+    mHasWork.notify_one();
+    wakeUp();
+}
+
+bool GAMSProcessReaper::stop(const shared_ptr<GAMSProcess> &process)
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        auto it = find_if(mWatches.begin(), mWatches.end(),
+                          [&process](const shared_ptr<Watch> &w) { return w->mProcess == process; });
+        if (it == mWatches.end())
+            return false;
+        if ((*it)->mEscalation == 0)
+            (*it)->mNextEscalation = chrono::steady_clock::now();
+    }
+    wakeUp();
+    return true;
+}
+
+void GAMSProcessReaper::outputConsumed()
+{
+    wakeUp();
+}
+
+void GAMSProcessReaper::escalate(Watch &watch, chrono::steady_clock::time_point now)
+{
+    if (watch.mEscalation == 0)
+        watch.mProcess->interrupt();
+    else if (watch.mEscalation == 1)
+        watch.mProcess->terminate();
+    else
+        watch.mProcess->kill();
+    watch.mEscalation++;
+    watch.mNextEscalation = now + cEscalationGrace;
+}
+
+void GAMSProcessReaper::wakeUp()
+{
+#ifndef _WIN32
+    char c = 0;
+    if (write(mWakeUp[1], &c, 1) < 0) {
+        // the pipe is full, so the reaper is going to wake up anyway
+    }
+#endif
+}
+
+bool GAMSProcessReaper::bufferFull(Watch &watch)
+{
+    lock_guard<mutex> lck(watch.mBufferLock);
+    return watch.mBuffered.size() >= cMaxBufferedOutput;
+}
+
+void GAMSProcessReaper::bufferOutput(const shared_ptr<Watch> &watch, const char *data, size_t size)
+{
+    lock_guard<mutex> lck(watch->mBufferLock);
+    watch->mBuffered.append(data, size);
+    scheduleDelivery(watch);
+}
+
+void GAMSProcessReaper::exited(const shared_ptr<Watch> &watch, int exitCode, bool stopped)
+{
+    lock_guard<mutex> lck(watch->mBufferLock);
+    watch->mExited = true;
+    watch->mExitCode = exitCode;
+    watch->mStopped = stopped;
+    scheduleDelivery(watch);
+}
+
+void GAMSProcessReaper::scheduleDelivery(const shared_ptr<Watch> &watch)
+{
+    if (watch->mDelivering)
+        return;
+    watch->mDelivering = true;
+    {
+        lock_guard<mutex> lck(mCallbackLock);
+        mCallbacks.push_back(watch);
+    }
+    mHasCallbacks.notify_one();
+}
+
+void GAMSProcessReaper::deliver(const shared_ptr<Watch> &watch)
+{
+    while (true) {
+        string output;
+        bool finished = false;
+        {
+            lock_guard<mutex> lck(watch->mBufferLock);
+            output.swap(watch->mBuffered);
+            if (output.empty()) {
+                // the reaper reads until the end of the output before it reaps, nothing follows the exit
+                finished = watch->mExited;
+                if (!finished) {
+                    watch->mDelivering = false;
+                    return;
+                }
+            }
+        }
+        if (finished) {
+            try {
+                watch->mOnFinished(watch->mExitCode, watch->mStopped);
+            } catch (...) {
+            }
+            return;
+        }
+        try {
+            watch->mOnOutput(output.data(), output.size());
+        } catch (...) {
+            // a failing output stream must not take down the callback thread
+        }
+        if (output.size() >= cMaxBufferedOutput)
+            wakeUp();
+    }
+}
+
+void GAMSProcessReaper::runCallbacks()
+{
+    while (true) {
+        shared_ptr<Watch> watch;
+        {
+            unique_lock<mutex> lck(mCallbackLock);
+            mHasCallbacks.wait(lck, [this] { return !mCallbacks.empty(); });
+            watch = std::move(mCallbacks.front());
+            mCallbacks.pop_front();
+        }
+        deliver(watch);
+    }
+}
+
+void GAMSProcessReaper::run()
+{
+    array<char, 4096> buffer;
+    while (true) {
+        vector<shared_ptr<Watch>> watches;
+        int timeout = -1;
+        {
+            unique_lock<mutex> lck(mLock);
+            mHasWork.wait(lck, [this] { return !mWatches.empty(); });
+            auto now = chrono::steady_clock::now();
+            for (auto &w : mWatches) {
+                if (w->mEscalation >= 3 || w->mNextEscalation == chrono::steady_clock::time_point::max())
+                    continue;
+                if (now >= w->mNextEscalation)
+                    escalate(*w, now);
+                if (w->mEscalation < 3) {
+                    auto ms = chrono::duration_cast<chrono::milliseconds>(w->mNextEscalation - now).count() + 1;
+                    timeout = (timeout < 0) ? static_cast<int>(ms) : min(timeout, static_cast<int>(ms));
+                }
+            }
+            watches = mWatches;
+        }
+
+        // evaluated without the lock, the consumers take their own locks
+        vector<bool> paused(watches.size(), false);
+        for (size_t i = 0; i < watches.size(); ++i) {
+            paused[i] = bufferFull(*watches[i]);
+            if (!paused[i] && watches[i]->mReadyForOutput)
+                paused[i] = !watches[i]->mReadyForOutput();
+        }
+
+        vector<bool> ready(watches.size(), false);
+#ifdef _WIN32
+        bool anyReady = false;
+        for (size_t i = 0; i < watches.size(); ++i) {
+            ready[i] = !paused[i] && watches[i]->mProcess->waitForReadyRead(0);
+            anyReady = anyReady || ready[i];
+        }
+        if (!anyReady) {
+            Sleep(static_cast<DWORD>((timeout < 0) ? 10 : min(timeout, 10)));
+            continue;
+        }
+#else
+        vector<pollfd> fds(watches.size() + 1);
+        fds[0].fd = mWakeUp[0];
+        fds[0].events = POLLIN;
+        fds[0].revents = 0;
+        for (size_t i = 0; i < watches.size(); ++i) {
+            // poll ignores negative descriptors
+            fds[i+1].fd = paused[i] ? -1 : watches[i]->mProcess->outputDescriptor();
+            fds[i+1].events = POLLIN;
+            fds[i+1].revents = 0;
+        }
+        if (poll(fds.data(), fds.size(), timeout) <= 0)
+            continue;
+        if (fds[0].revents) {
+            char drain[64];
+            while (::read(mWakeUp[0], drain, sizeof(drain)) > 0) {}
+        }
+        for (size_t i = 0; i < watches.size(); ++i)
+            ready[i] = fds[i+1].revents != 0;
+#endif
+
+        for (size_t i = 0; i < watches.size(); ++i) {
+            if (!ready[i])
+                continue;
+            Watch &w = *watches[i];
+            size_t n = w.mProcess->read(buffer.data(), buffer.size());
+            if (n > 0) {
+                bufferOutput(watches[i], buffer.data(), n);
+                continue;
+            }
+            int exitCode = w.mProcess->wait();
+            bool stopped;
+            {
+                lock_guard<mutex> lck(mLock);
+                stopped = w.mEscalation > 0;
+                mWatches.erase(find(mWatches.begin(), mWatches.end(), watches[i]));
+            }
+            exited(watches[i], exitCode, stopped);
+        }
+    }
+}
+
+} // namespace gams
@@ -0,0 +1,138 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSPROCESSREAPER_H
+#define GAMSPROCESSREAPER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace gams {
+
+class GAMSProcess;
+
+/// Watches all running GAMS processes of the API from a single background thread:
+/// it forwards their output, enforces time limits and reaps them when they terminate.
+/// <p>The reaper thread only polls, reads, reaps and signals. Output is buffered per process and,
+/// like the notification about the terminated process, passed on by a small pool of callback
+/// threads, so a slow consumer only delays its own process.</p>
+class GAMSProcessReaper
+{
+public:
+    /// Callback receiving a chunk of process output.
+    typedef std::function<void(const char *data, std::size_t size)> OutputHandler;
+
+    /// Callback called after the process has been reaped.
+    /// \param exitCode Exit code of the process.
+    /// \param stopped <c>true</c> if the process has been interrupted or killed by the reaper.
+    typedef std::function<void(int exitCode, bool stopped)> FinishedHandler;
+
+    /// Callback checked before reading output; reading is paused while it returns <c>false</c>.
+    typedef std::function<bool()> ReadyHandler;
+
+    /// Get the one and only GAMSProcessReaper instance.
+    static GAMSProcessReaper& instance();
+
+    /// Watch a started process.
+    /// \param process The started process.
+    /// \param onOutput Called from a callback thread for the buffered output; the calls for one
+    ///                 process never overlap and keep the order of the output.
+    /// \param onFinished Called from a callback thread after the process has been reaped and all
+    ///                   output has been passed to onOutput.
+    /// \param timeLimit Wall-clock time after which the process is stopped (zero: no limit).
+    /// \param readyForOutput Checked by the reaper thread, without holding locks of the reaper, before
+    ///                       reading output. A paused process blocks as soon as its output pipe is full.
+    ///                       Reading is also paused while too much output of the process is buffered.
+    void watch(const std::shared_ptr<GAMSProcess> &process, const OutputHandler &onOutput,
+               const FinishedHandler &onFinished,
+               std::chrono::milliseconds timeLimit = std::chrono::milliseconds::zero(),
+               const ReadyHandler &readyForOutput = nullptr);
+
+    /// Tell the reaper that a consumer pausing the output of a process has made room again.
+    void outputConsumed();
+
+    /// Stop a watched process by escalating SIGINT, SIGTERM and SIGKILL.
+    /// \param process The process to stop.
+    /// \return Returns <c>true</c> if the process is watched; otherwise <c>false</c>.
+    bool stop(const std::shared_ptr<GAMSProcess> &process);
+
+private:
+    struct Watch
+    {
+        std::shared_ptr<GAMSProcess> mProcess;
+        OutputHandler mOnOutput;
+        FinishedHandler mOnFinished;
+        ReadyHandler mReadyForOutput;
+        std::chrono::steady_clock::time_point mNextEscalation;
+        int mEscalation = 0;
+
+        /// Output and exit status not passed to the callbacks yet, guarded by mBufferLock
+        std::mutex mBufferLock;
+        std::string mBuffered;
+        bool mDelivering = false;
+        bool mExited = false;
+        int mExitCode = -1;
+        bool mStopped = false;
+    };
+
+    GAMSProcessReaper();
+    void run();
+    void escalate(Watch &watch, std::chrono::steady_clock::time_point now);
+    void wakeUp();
+
+    /// Check if the reaper stops reading output because too much of it is buffered
+    bool bufferFull(Watch &watch);
+    /// Append output of a process to its buffer and schedule its delivery
+    void bufferOutput(const std::shared_ptr<Watch> &watch, const char *data, std::size_t size);
+    /// Record the exit status of a reaped process and schedule its delivery
+    void exited(const std::shared_ptr<Watch> &watch, int exitCode, bool stopped);
+    /// Schedule the delivery of a watch unless one is running, called with its mBufferLock held
+    void scheduleDelivery(const std::shared_ptr<Watch> &watch);
+    /// Pass the buffered output and finally the exit status of a watch to its callbacks
+    void deliver(const std::shared_ptr<Watch> &watch);
+    /// Run the tasks of the callback threads
+    void runCallbacks();
+
+    std::mutex mLock;
+    std::condition_variable mHasWork;
+    std::vector<std::shared_ptr<Watch>> mWatches;
+
+    std::mutex mCallbackLock;
+    std::condition_variable mHasCallbacks;
+    std::deque<std::shared_ptr<Watch>> mCallbacks;
+#ifndef _WIN32
+    int mWakeUp[2] = { -1, -1 };
+#endif
+};
+
+} // namespace gams
+
+#endif // GAMSPROCESSREAPER_H
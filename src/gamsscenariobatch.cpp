@@ -0,0 +1,92 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsscenariobatch.h"
+#include "gamsscenariobatchimpl.h"
+#include "gamsoptions.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSScenarioBatch::GAMSScenarioBatch()
+{}
+
+GAMSScenarioBatch::GAMSScenarioBatch(const GAMSCheckpoint &checkpoint, const string &scenarioSource)
+    : mImpl(make_shared<GAMSScenarioBatchImpl>(checkpoint, scenarioSource))
+{}
+
+GAMSScenarioBatch::~GAMSScenarioBatch()
+{}
+
+bool GAMSScenarioBatch::isValid() const
+{
+    return bool(mImpl);
+}
+
+int GAMSScenarioBatch::addScenario(const GAMSDatabase &inputs)
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    return mImpl->addScenario(inputs);
+}
+
+int GAMSScenarioBatch::numberOfScenarios() const
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    return static_cast<int>(mImpl->mScenarios.size());
+}
+
+void GAMSScenarioBatch::run()
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    mImpl->run(nullptr, nullptr);
+}
+
+void GAMSScenarioBatch::run(GAMSOptions &gamsOptions)
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    mImpl->run(&gamsOptions, nullptr);
+}
+
+void GAMSScenarioBatch::run(GAMSOptions &gamsOptions, ostream &output)
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    mImpl->run(&gamsOptions, &output);
+}
+
+GAMSDatabase GAMSScenarioBatch::outDB(int scenario)
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    return mImpl->outDB(scenario);
+}
+
+LogId GAMSScenarioBatch::logID()
+{
+    if (!mImpl) throw GAMSException("GAMSScenarioBatch: This batch has not been initialized.");
+    return mImpl->logID();
+}
+
+} // namespace gams
@@ -0,0 +1,110 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSCENARIOBATCH_H
+#define GAMSSCENARIOBATCH_H
+
+#include "gamslib_global.h"
+#include <string>
+#include <memory>
+#include <ostream>
+
+namespace gams {
+
+class GAMSCheckpoint;
+class GAMSDatabase;
+class GAMSOptions;
+class GAMSScenarioBatchImpl;
+
+/// <p>A GAMSScenarioBatch runs many scenarios of a model in a single GAMS process. It is
+/// created from a GAMSCheckpoint containing the model and a scenario source, e.g.
+/// "solve transport min z use lp;". Each scenario consists of a GAMSDatabase with input
+/// data.</p>
+/// <p>The run generates a driver program with a single loop over the scenarios which loads
+/// the symbols of the scenario database (execute_load), executes the scenario source and
+/// writes all symbols to a result GDX file (execute_unload). Process startup and compilation
+/// are paid once per batch instead of once per scenario, and the driver does not grow with the
+/// number of scenarios.</p>
+/// <p>The scenario source is executed inside the loop and therefore must not contain
+/// declarations or equation definitions. Scenarios run one after the other in the same GAMS
+/// process: symbols not contained in a scenario database keep the values left by the previous
+/// scenario.</p>
+/// <p>The exported scenario databases are removed after the run, the result GDX files with the
+/// next run or the GAMSScenarioBatch, unless the debug level of the workspace keeps files.</p>
+class LIBSPEC GAMSScenarioBatch
+{
+public:
+    /// Default constructor.
+    GAMSScenarioBatch();
+
+    /// Destructor.
+    ~GAMSScenarioBatch();
+
+    /// Checks if a GAMSScenarioBatch is valid.
+    /// \return Returns <c>true</c> if the GAMSScenarioBatch is valid; otherwise <c>false</c>.
+    bool isValid() const;
+
+    /// Add a scenario.
+    /// \param inputs GAMSDatabase with the symbols to load before the scenario source is executed.
+    ///               It is exported when the batch is run.
+    /// \return Returns the index of the scenario.
+    int addScenario(const GAMSDatabase &inputs);
+
+    /// Get the number of scenarios.
+    int numberOfScenarios() const;
+
+    /// Run all scenarios in one GAMS process.
+    void run();
+
+    /// Run all scenarios in one GAMS process.
+    /// \param gamsOptions GAMSOptions to control the GAMS run.
+    void run(GAMSOptions &gamsOptions);
+
+    /// Run all scenarios in one GAMS process.
+    /// \param gamsOptions GAMSOptions to control the GAMS run.
+    /// \param output Stream to capture GAMS log.
+    void run(GAMSOptions &gamsOptions, std::ostream &output);
+
+    /// Get the results of a scenario of the last run. The result GDX file is read on the
+    /// first access. Results of scenarios completed before a failing one stay available.
+    /// \param scenario Index of the scenario.
+    /// \return Returns the GAMSDatabase with all symbols after the scenario has been executed.
+    GAMSDatabase outDB(int scenario);
+
+    /// Get the GAMS log ID.
+    /// \return Returns the GAMS log ID.
+    LogId logID();
+
+private:
+    friend class GAMSCheckpointImpl;
+    GAMSScenarioBatch(const GAMSCheckpoint &checkpoint, const std::string &scenarioSource);
+
+private:
+    std::shared_ptr<GAMSScenarioBatchImpl> mImpl;
+};
+
+} // namespace gams
+
+#endif // GAMSSCENARIOBATCH_H
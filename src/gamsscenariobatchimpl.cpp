@@ -0,0 +1,188 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsscenariobatchimpl.h"
+#include "gamsjob.h"
+#include "gamsjobimpl.h"
+#include "gamsoptions.h"
+#include "gamssymbol.h"
+#include "gamspath.h"
+#include "gamsexception.h"
+
+#include <atomic>
+#include <sstream>
+#include <algorithm>
+#include <filesystem>
+
+using namespace std;
+
+namespace gams {
+
+GAMSScenarioBatchImpl::GAMSScenarioBatchImpl(const GAMSCheckpoint &checkpoint, const string &scenarioSource)
+    : mWs(const_cast<GAMSCheckpoint&>(checkpoint).workspace()), mCheckpoint(checkpoint), mScenarioSource(scenarioSource)
+{}
+
+int GAMSScenarioBatchImpl::addScenario(const GAMSDatabase &inputs)
+{
+    if (!inputs.isValid())
+        throw GAMSException("GAMSScenarioBatch: The scenario database has not been initialized.");
+    mScenarios.push_back(inputs);
+    return static_cast<int>(mScenarios.size()) - 1;
+}
+
+GAMSScenarioBatchImpl::~GAMSScenarioBatchImpl()
+{
+    if (mWs.debug() < GAMSEnum::DebugLevel::KeepFiles)
+        removeFiles(mOutFiles);
+}
+
+void GAMSScenarioBatchImpl::removeFiles(const vector<string> &files)
+{
+    error_code ec;
+    for (const string &file : files)
+        filesystem::remove(file, ec);
+}
+
+vector<string> GAMSScenarioBatchImpl::exportScenarios(const string &fileStem)
+{
+    vector<string> inFiles;
+    for (size_t i = 0; i < mScenarios.size(); ++i) {
+        inFiles.push_back(fileStem + "_in" + to_string(i + 1) + ".gdx");
+        mScenarios[i].doExport(inFiles.back());
+    }
+    return inFiles;
+}
+
+/// Quote a text for GAMS, which has no escapes in quoted strings
+static string quoted(const string &text)
+{
+    if (text.find('\'') == string::npos)
+        return '\'' + text + '\'';
+    if (text.find('"') == string::npos)
+        return '"' + text + '"';
+    throw GAMSException("GAMSScenarioBatch: The path " + text + " contains both kinds of quotes.");
+}
+
+string GAMSScenarioBatchImpl::driverSource(const string &fileStem)
+{
+    const string putFile = quoted(fileStem + ".put");
+    const string inStem = quoted(fileStem + "_in");
+    const string outStem = quoted(fileStem + "_out");
+
+    // scenarios loading the same symbols share one execute_load statement
+    vector<string> loads;
+    vector<size_t> loadOfScenario;
+    for (GAMSDatabase db : mScenarios) {
+        string symbols;
+        for (GAMSSymbol sym : db)
+            symbols += (symbols.empty() ? "" : ", ") + sym.name();
+        auto it = find(loads.begin(), loads.end(), symbols);
+        loadOfScenario.push_back(it - loads.begin());
+        if (it == loads.end())
+            loads.push_back(symbols);
+    }
+
+    ostringstream source;
+    source << "* driver for " << mScenarios.size() << " scenarios\n";
+    source << "Set gamscppsb_s 'scenarios' / 1*" << mScenarios.size() << " /;\n";
+    source << "File gamscppsb_f / " << putFile << " /;\n";
+    if (loads.size() > 1) {
+        for (size_t l = 0; l < loads.size(); ++l) {
+            source << "Set gamscppsb_l" << l + 1 << "(gamscppsb_s) /";
+            bool first = true;
+            for (size_t i = 0; i < mScenarios.size(); ++i) {
+                if (loadOfScenario[i] != l)
+                    continue;
+                source << (first ? " " : ", ") << i + 1;
+                first = false;
+            }
+            source << " /;\n";
+        }
+    }
+    source << "loop(gamscppsb_s,\n";
+    source << "put_utility gamscppsb_f 'gdxIn' / " << inStem << " gamscppsb_s.tl:0 '.gdx';\n";
+    for (size_t l = 0; l < loads.size(); ++l) {
+        if (loads[l].empty())
+            continue;
+        if (loads.size() > 1)
+            source << "if(gamscppsb_l" << l + 1 << "(gamscppsb_s), execute_load " << loads[l] << ";);\n";
+        else
+            source << "execute_load " << loads[l] << ";\n";
+    }
+    source << mScenarioSource << "\n";
+    source << "put_utility gamscppsb_f 'gdxOut' / " << outStem << " gamscppsb_s.tl:0 '.gdx';\n";
+    source << "execute_unload;\n";
+    source << ");\n";
+    return source.str();
+}
+
+void GAMSScenarioBatchImpl::run(GAMSOptions *gamsOptions, ostream *output)
+{
+    if (mScenarios.empty())
+        throw GAMSException("GAMSScenarioBatch: The batch has no scenarios.");
+
+    // unique within the process, the workspace pool keeps other processes out of the working directory
+    static atomic<int> batchCounter(0);
+    string fileStem = GAMSPath(mWs.workingDirectory(),
+                               mWs.scratchFilePrefix() + "sb" + to_string(batchCounter++)).toStdString();
+
+    bool keepFiles = mWs.debug() >= GAMSEnum::DebugLevel::KeepFiles;
+    // results of the previous run not read yet are replaced
+    if (!keepFiles)
+        removeFiles(mOutFiles);
+    mOutFiles.clear();
+    mOutDbs.assign(mScenarios.size(), GAMSDatabase());
+    for (size_t i = 0; i < mScenarios.size(); ++i)
+        mOutFiles.push_back(fileStem + "_out" + to_string(i + 1) + ".gdx");
+
+    string source = driverSource(fileStem);
+    vector<string> inFiles = exportScenarios(fileStem);
+    inFiles.push_back(fileStem + ".put");
+    GAMSJob job = mWs.addJobFromString(source, mCheckpoint);
+    try {
+        // results are written per scenario, the driver itself needs no out database
+        job.mImpl->run(gamsOptions, nullptr, output, false);
+    } catch (...) {
+        if (mWs.debug() < GAMSEnum::DebugLevel::KeepFilesOnError)
+            removeFiles(inFiles);
+        throw;
+    }
+    if (!keepFiles)
+        removeFiles(inFiles);
+}
+
+GAMSDatabase GAMSScenarioBatchImpl::outDB(int scenario)
+{
+    if (scenario < 0 || scenario >= static_cast<int>(mOutFiles.size()))
+        throw GAMSException("GAMSScenarioBatch: Scenario " + to_string(scenario) + " has not been run.");
+    if (!mOutDbs[scenario].isValid()) {
+        if (!GAMSPath::exists(mOutFiles[scenario]))
+            throw GAMSException("GAMSScenarioBatch: Scenario " + to_string(scenario) + " has no results.");
+        mOutDbs[scenario] = mWs.addDatabaseFromGDX(mOutFiles[scenario]);
+    }
+    return mOutDbs[scenario];
+}
+
+} // namespace gams
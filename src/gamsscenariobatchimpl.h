@@ -0,0 +1,75 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSCENARIOBATCHIMPL_H
+#define GAMSSCENARIOBATCHIMPL_H
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include "gamsworkspace.h"
+#include "gamscheckpoint.h"
+#include "gamsdatabase.h"
+
+namespace gams {
+
+class GAMSOptions;
+
+class GAMSScenarioBatchImpl
+{
+public:
+    GAMSScenarioBatchImpl(const GAMSCheckpoint &checkpoint, const std::string &scenarioSource);
+    /// Removes the result GDX files unless the debug level keeps files
+    ~GAMSScenarioBatchImpl();
+
+    int addScenario(const GAMSDatabase &inputs);
+    void run(GAMSOptions *gamsOptions, std::ostream *output);
+    GAMSDatabase outDB(int scenario);
+
+    /// Export the scenario databases to the input GDX files of a run
+    /// \returns The input GDX files
+    std::vector<std::string> exportScenarios(const std::string &fileStem);
+
+    /// Generate the driver program: a single loop over all scenarios, its size does not depend
+    /// on the number of scenarios sharing the same input symbols
+    std::string driverSource(const std::string &fileStem);
+
+    static void removeFiles(const std::vector<std::string> &files);
+
+    LogId logID() { return mWs.logID(); }
+
+    GAMSWorkspace mWs;
+    GAMSCheckpoint mCheckpoint;
+    std::string mScenarioSource;
+    std::vector<GAMSDatabase> mScenarios;
+
+    /// Result GDX files of the last run and the databases read from them
+    std::vector<std::string> mOutFiles;
+    std::vector<GAMSDatabase> mOutDbs;
+};
+
+} // namespace gams
+
+#endif // GAMSSCENARIOBATCHIMPL_H
@@ -0,0 +1,180 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamsscratchcleaner.h"
+#include <filesystem>
+#include <algorithm>
+
+using namespace std;
+
+namespace gams {
+
+const chrono::milliseconds GAMSScratchCleaner::cInterval(1000);
+
+GAMSScratchCleaner::~GAMSScratchCleaner()
+{
+    stop();
+}
+
+int GAMSScratchCleaner::retentionCount() const
+{
+    lock_guard<mutex> lck(mLock);
+    return mCount;
+}
+
+void GAMSScratchCleaner::setRetentionCount(int count)
+{
+    lock_guard<mutex> lck(mLock);
+    mCount = count < 0 ? -1 : count;
+    startIfEnabled();
+}
+
+uint64_t GAMSScratchCleaner::retentionBytes() const
+{
+    lock_guard<mutex> lck(mLock);
+    return mBytes;
+}
+
+void GAMSScratchCleaner::setRetentionBytes(uint64_t bytes)
+{
+    lock_guard<mutex> lck(mLock);
+    mBytes = bytes;
+    startIfEnabled();
+}
+
+void GAMSScratchCleaner::add(const weak_ptr<void> &owner, const vector<string> &files)
+{
+    {
+        lock_guard<mutex> lck(mLock);
+        if (!enabled())
+            return;
+    }
+    Group added;
+    added.owner = owner;
+    for (const string &file : files) {
+        error_code ec;
+        auto size = filesystem::file_size(file, ec);
+        if (ec) continue;
+        added.files.emplace_back(file, size);
+        added.bytes += size;
+    }
+    if (added.files.empty())
+        return;
+
+    // the key is only valid while the owner is alive, a released owner gets a group of its own
+    shared_ptr<void> alive = owner.lock();
+    lock_guard<mutex> lck(mLock);
+    auto it = alive ? mGroupsByOwner.find(alive.get()) : mGroupsByOwner.end();
+    if (it == mGroupsByOwner.end() || it->second->owner.expired()) {
+        added.key = alive.get();
+        mGroups.push_back(std::move(added));
+        if (alive)
+            mGroupsByOwner[alive.get()] = prev(mGroups.end());
+        return;
+    }
+    Group &group = *it->second;
+    for (auto &file : added.files) {
+        auto known = find_if(group.files.begin(), group.files.end(),
+                             [&file](const pair<string, uint64_t> &f) { return f.first == file.first; });
+        if (known == group.files.end()) {
+            group.files.push_back(file);
+            group.bytes += file.second;
+        } else {
+            group.bytes = group.bytes - known->second + file.second;
+            known->second = file.second;
+        }
+    }
+    mGroups.splice(mGroups.end(), mGroups, it->second);
+}
+
+int GAMSScratchCleaner::clean()
+{
+    vector<string> victims;
+    {
+        lock_guard<mutex> lck(mLock);
+        if (!enabled())
+            return 0;
+        int keptCount = 0;
+        uint64_t keptBytes = 0;
+        bool full = false;
+        for (auto it = mGroups.end(); it != mGroups.begin(); ) {
+            --it;
+            if (!it->owner.expired())
+                continue;
+            if (!full) {
+                full = (mCount >= 0 && keptCount + 1 > mCount) || (mBytes > 0 && keptBytes + it->bytes > mBytes);
+                if (!full) {
+                    ++keptCount;
+                    keptBytes += it->bytes;
+                    continue;
+                }
+            }
+            for (auto &file : it->files)
+                victims.push_back(file.first);
+            auto known = mGroupsByOwner.find(it->key);
+            if (known != mGroupsByOwner.end() && known->second == it)
+                mGroupsByOwner.erase(known);
+            it = mGroups.erase(it);
+        }
+    }
+    int removed = 0;
+    for (const string &file : victims) {
+        error_code ec;
+        if (filesystem::remove(file, ec))
+            ++removed;
+    }
+    return removed;
+}
+
+void GAMSScratchCleaner::stop()
+{
+    thread cleaner;
+    {
+        lock_guard<mutex> lck(mLock);
+        mStop = true;
+        cleaner = std::move(mThread);
+    }
+    mWake.notify_all();
+    if (cleaner.joinable())
+        cleaner.join();
+}
+
+void GAMSScratchCleaner::startIfEnabled()
+{
+    if (enabled() && !mStop && !mThread.joinable())
+        mThread = thread(&GAMSScratchCleaner::run, this);
+}
+
+void GAMSScratchCleaner::run()
+{
+    unique_lock<mutex> lck(mLock);
+    while (!mWake.wait_for(lck, cInterval, [this] { return mStop; })) {
+        lck.unlock();
+        clean();
+        lck.lock();
+    }
+}
+
+} // namespace gams
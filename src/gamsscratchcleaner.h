@@ -0,0 +1,109 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSCRATCHCLEANER_H
+#define GAMSSCRATCHCLEANER_H
+
+#include <string>
+#include <vector>
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+
+namespace gams {
+
+/// Removes the scratch files of released jobs and databases of a workspace.
+/// <p>Files are added in groups, each belonging to an owner like the implementation of a job.
+/// The files of an owner which is still referenced are never removed. Of the groups of released
+/// owners the most recent ones are kept as long as they fit the retention count and the retention
+/// bytes, older ones are removed by a background thread.</p>
+/// <p>Nothing is tracked before a retention policy is set.</p>
+class GAMSScratchCleaner
+{
+public:
+    /// Stops the background thread, the remaining files are left to the workspace
+    ~GAMSScratchCleaner();
+
+    /// Number of groups of released owners kept; negative keeps all
+    int retentionCount() const;
+    /// Set the retention count and start the background thread if a limit is set
+    void setRetentionCount(int count);
+    /// Bytes kept for the groups of released owners; zero keeps all
+    std::uint64_t retentionBytes() const;
+    /// Set the retention bytes and start the background thread if a limit is set
+    void setRetentionBytes(std::uint64_t bytes);
+
+    /// Add files to the group of an owner; the group becomes the most recent one.
+    /// \param owner Object the files belong to, the files are kept while it is alive.
+    /// \param files Files of the owner, missing files are ignored.
+    void add(const std::weak_ptr<void> &owner, const std::vector<std::string> &files);
+
+    /// Remove the files exceeding the retention policy now.
+    /// \returns Number of removed files.
+    int clean();
+
+    /// Stop the background thread
+    void stop();
+
+private:
+    struct Group
+    {
+        std::weak_ptr<void> owner;
+        /// Address of the owner when the group was created, only valid while the owner is alive
+        const void *key = nullptr;
+        /// Files with their size when they were added
+        std::vector<std::pair<std::string, std::uint64_t>> files;
+        std::uint64_t bytes = 0;
+    };
+
+    /// Interval in which the background thread looks for released owners
+    static const std::chrono::milliseconds cInterval;
+
+    bool enabled() const { return mCount >= 0 || mBytes > 0; }
+    /// Start the background thread if a limit is set, called with mLock held
+    void startIfEnabled();
+    void run();
+
+    mutable std::mutex mLock;
+    std::condition_variable mWake;
+    std::thread mThread;
+    bool mStop = false;
+
+    int mCount = -1;
+    std::uint64_t mBytes = 0;
+
+    /// Groups from the oldest to the most recent one
+    std::list<Group> mGroups;
+    std::unordered_map<const void*, std::list<Group>::iterator> mGroupsByOwner;
+};
+
+} // namespace gams
+
+#endif // GAMSSCRATCHCLEANER_H
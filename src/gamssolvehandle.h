@@ -0,0 +1,111 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSOLVEHANDLE_H
+#define GAMSSOLVEHANDLE_H
+
+#include "gamslib_global.h"
+#include <memory>
+#include <chrono>
+#include "gamsenum.h"
+
+namespace gams {
+
+class GAMSModelInstance;
+class GAMSSolveHandleImpl;
+
+/// <p>The GAMSSolveHandle class represents a solve started with GAMSModelInstance::solveAsync
+/// or GAMSModelInstance::solvePortfolio. The solver runs in a library thread, the model
+/// instance must not be used until the solve has finished. Another solve of the model instance
+/// started in the meantime throws a GAMSException.</p>
+/// <p>A solve that is cancelled or exceeds its time limit is interrupted. The solver then
+/// returns the best solution it has found so far, so the results stay available and wait()
+/// does not throw. Exceptions of the solve itself are rethrown by wait().</p>
+class LIBSPEC GAMSSolveHandle
+{
+public:
+    /// Default constructor.
+    GAMSSolveHandle();
+
+    /// Destructor. The last handle referencing a solve joins its solver threads, so dropping it
+    /// blocks until all solvers returned. The solvers are not interrupted, call cancel() first
+    /// to stop them early.
+    ~GAMSSolveHandle();
+
+    /// Check if a GAMSSolveHandle is valid.
+    /// \return Returns <c>true</c> if the GAMSSolveHandle is valid; otherwise <c>false</c>.
+    bool isValid() const;
+
+    /// Block until the result is available. In a portfolio the remaining solvers are interrupted
+    /// once a result has been accepted, the result is available when all of them returned. Thus
+    /// wait() also waits for the slowest solver to react to the interrupt.
+    /// Rethrows the exception of a failed solve. In a portfolio this happens only if all solves failed.
+    void wait();
+
+    /// Block until the result is available or the timeout expired.
+    /// \param timeout Maximum time to wait.
+    /// \return Returns <c>true</c> if the result is available (and evaluated like in wait());
+    ///         otherwise <c>false</c>.
+    bool waitFor(std::chrono::milliseconds timeout);
+
+    /// Interrupt the running solvers.
+    /// \return Returns <c>true</c> if a solver was still running and had not been interrupted yet; otherwise <c>false</c>.
+    bool cancel();
+
+    /// Get the status of the solve without blocking.
+    /// \return Returns JobRunning while no result is available, JobFinished for an accepted result,
+    ///         JobFailed if no result was accepted or the solve failed, JobCancelled after cancel()
+    ///         and JobTimedOut if the time limit was exceeded.
+    GAMSEnum::JobStatus status() const;
+
+    /// Wait for the result and get the model instance holding it.
+    /// \return Returns the solved model instance, in a portfolio the clone of the winning alternative.
+    GAMSModelInstance modelInstance();
+
+    /// Wait for the result and get the index of the alternative that produced it.
+    /// \return Returns the index in the alternatives of GAMSModelInstance::solvePortfolio (0 for solveAsync).
+    int winner();
+
+    /// Wait for the result and check if it has been accepted.
+    /// \return Returns <c>true</c> if the result passed the acceptance check; otherwise <c>false</c>.
+    bool accepted();
+
+    /// Wait for the result and get its model status.
+    GAMSEnum::ModelStat modelStatus();
+
+    /// Wait for the result and get its solve status.
+    GAMSEnum::SolveStat solveStatus();
+
+private:
+    friend class GAMSModelInstance;
+    GAMSSolveHandle(const std::shared_ptr<GAMSSolveHandleImpl>& impl);
+
+private:
+    std::shared_ptr<GAMSSolveHandleImpl> mImpl;
+};
+
+} // namespace gams
+
+#endif // GAMSSOLVEHANDLE_H
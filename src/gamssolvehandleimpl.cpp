@@ -0,0 +1,199 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamssolvehandleimpl.h"
+#include "gamsmodelinstanceimpl.h"
+#include "gamsexception.h"
+
+using namespace std;
+
+namespace gams {
+
+GAMSSolveHandleImpl::GAMSSolveHandleImpl(const vector<GAMSModelInstance> &instances,
+                                         const vector<GAMSModelInstanceOpt> &alternatives,
+                                         GAMSEnum::SymbolUpdateType updateType,
+                                         chrono::steady_clock::time_point start,
+                                         chrono::milliseconds timeLimit,
+                                         const Acceptance &acceptable)
+    : mInstances(instances), mAlternatives(alternatives), mActive(instances.size(), true)
+    , mUpdateType(updateType), mDeadline(start + timeLimit)
+    , mHasDeadline(timeLimit > chrono::milliseconds::zero()), mAcceptable(acceptable)
+    , mRunning(instances.size())
+{
+    for (size_t i = 0; i < mInstances.size(); ++i)
+        mThreads.emplace_back(&GAMSSolveHandleImpl::run, this, i);
+    mSupervisor = thread(&GAMSSolveHandleImpl::supervise, this);
+}
+
+GAMSSolveHandleImpl::~GAMSSolveHandleImpl()
+{
+    for (thread &t : mThreads)
+        t.join();
+    mSupervisor.join();
+}
+
+void GAMSSolveHandleImpl::wait()
+{
+    unique_lock<mutex> lock(mLock);
+    mChanged.wait(lock, [this] { return done(); });
+    if (mWinner < 0 && mError)
+        rethrow_exception(mError);
+}
+
+bool GAMSSolveHandleImpl::waitFor(chrono::milliseconds timeout)
+{
+    unique_lock<mutex> lock(mLock);
+    if (!mChanged.wait_for(lock, timeout, [this] { return done(); }))
+        return false;
+    if (mWinner < 0 && mError)
+        rethrow_exception(mError);
+    return true;
+}
+
+bool GAMSSolveHandleImpl::cancel()
+{
+    lock_guard<mutex> lock(mLock);
+    if (done() || mStopped)
+        return false;
+    mCancelled = true;
+    stop();
+    return true;
+}
+
+GAMSEnum::JobStatus GAMSSolveHandleImpl::status() const
+{
+    lock_guard<mutex> lock(mLock);
+    if (!done())
+        return GAMSEnum::JobStatus::JobRunning;
+    if (mCancelled)
+        return GAMSEnum::JobStatus::JobCancelled;
+    if (mTimedOut)
+        return GAMSEnum::JobStatus::JobTimedOut;
+    return mAccepted ? GAMSEnum::JobStatus::JobFinished : GAMSEnum::JobStatus::JobFailed;
+}
+
+GAMSModelInstance GAMSSolveHandleImpl::modelInstance() const
+{
+    lock_guard<mutex> lock(mLock);
+    return mInstances[mWinner < 0 ? 0 : size_t(mWinner)];
+}
+
+int GAMSSolveHandleImpl::winner() const
+{
+    lock_guard<mutex> lock(mLock);
+    return mWinner;
+}
+
+bool GAMSSolveHandleImpl::accepted() const
+{
+    lock_guard<mutex> lock(mLock);
+    return mAccepted;
+}
+
+bool GAMSSolveHandleImpl::isAcceptable(GAMSModelInstance &mi)
+{
+    if (mi.solveStatus() != GAMSEnum::SolveStat::Normal)
+        return false;
+    switch (mi.modelStatus()) {
+    case GAMSEnum::ModelStat::OptimalGlobal:
+    case GAMSEnum::ModelStat::OptimalLocal:
+    case GAMSEnum::ModelStat::IntegerSolution:
+    case GAMSEnum::ModelStat::SolvedUnique:
+    case GAMSEnum::ModelStat::Solved:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void GAMSSolveHandleImpl::run(size_t index)
+{
+    {
+        lock_guard<mutex> lock(mLock);
+        if (mStopped) {
+            mInstances[index].mImpl->endSolve();
+            mActive[index] = false;
+            --mRunning;
+            mChanged.notify_all();
+            return;
+        }
+    }
+    GAMSModelInstance &mi = mInstances[index];
+    bool solved = false;
+    bool acceptable = false;
+    exception_ptr error;
+    try {
+        mi.mImpl->solve(mUpdateType, nullptr, mAlternatives[index]);
+        solved = true;
+        acceptable = mAcceptable ? mAcceptable(mi) : isAcceptable(mi);
+    } catch (...) {
+        error = current_exception();
+    }
+    // the instance can be solved again once wait() returns
+    mi.mImpl->endSolve();
+
+    lock_guard<mutex> lock(mLock);
+    mActive[index] = false;
+    --mRunning;
+    if (error && !mError)
+        mError = error;
+    if (solved && !mAccepted) {
+        if (acceptable) {
+            mWinner = int(index);
+            mAccepted = true;
+            stop();
+        } else if (mWinner < 0) {
+            mWinner = int(index);
+        }
+    }
+    mChanged.notify_all();
+}
+
+void GAMSSolveHandleImpl::supervise()
+{
+    unique_lock<mutex> lock(mLock);
+    if (mHasDeadline) {
+        if (!mChanged.wait_until(lock, mDeadline, [this] { return done() || mStopped; })) {
+            mTimedOut = true;
+            stop();
+        }
+    }
+    mChanged.wait(lock, [this] { return mStopped || mRunning == 0; });
+    // a solver may still be starting when the interrupt is raised, so repeat it until all returned
+    while (!mChanged.wait_for(lock, chrono::milliseconds(100), [this] { return mRunning == 0; }))
+        stop();
+}
+
+void GAMSSolveHandleImpl::stop()
+{
+    mStopped = true;
+    for (size_t i = 0; i < mInstances.size(); ++i) {
+        if (mActive[i])
+            mInstances[i].interrupt();
+    }
+    mChanged.notify_all();
+}
+
+} // namespace gams
@@ -0,0 +1,104 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSOLVEHANDLEIMPL_H
+#define GAMSSOLVEHANDLEIMPL_H
+
+#include <memory>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+#include "gamsenum.h"
+#include "gamsmodelinstance.h"
+#include "gamsmodelinstanceopt.h"
+
+namespace gams {
+
+class GAMSSolveHandleImpl
+{
+public:
+    typedef GAMSModelInstance::Acceptance Acceptance;
+
+    /// Starts one solver thread per instance, instances[i] is solved with alternatives[i]. The
+    /// instances are marked as solving by the caller and released when their solve returned.
+    /// \param start Point in time the time limit counts from
+    GAMSSolveHandleImpl(const std::vector<GAMSModelInstance> &instances,
+                        const std::vector<GAMSModelInstanceOpt> &alternatives,
+                        GAMSEnum::SymbolUpdateType updateType,
+                        std::chrono::steady_clock::time_point start,
+                        std::chrono::milliseconds timeLimit,
+                        const Acceptance &acceptable);
+
+    /// Joins the solver threads
+    ~GAMSSolveHandleImpl();
+
+    void wait();
+    bool waitFor(std::chrono::milliseconds timeout);
+    bool cancel();
+    GAMSEnum::JobStatus status() const;
+
+    GAMSModelInstance modelInstance() const;
+    int winner() const;
+    bool accepted() const;
+
+    /// Default acceptance: normal completion and a (locally) optimal, integer or solved model status
+    static bool isAcceptable(GAMSModelInstance &mi);
+
+private:
+    void run(size_t index);
+    /// Enforces the time limit and repeats the interrupt until all stopped solvers returned
+    void supervise();
+    /// Interrupts all running solvers, the caller holds mLock
+    void stop();
+    /// The result is final once all solves returned, the others are interrupted after an accepted solve
+    bool done() const { return mRunning == 0; }
+
+    std::vector<GAMSModelInstance> mInstances;
+    std::vector<GAMSModelInstanceOpt> mAlternatives;
+    std::vector<bool> mActive;
+    GAMSEnum::SymbolUpdateType mUpdateType;
+    std::chrono::steady_clock::time_point mDeadline;
+    bool mHasDeadline;
+    Acceptance mAcceptable;
+
+    mutable std::mutex mLock;
+    std::condition_variable mChanged;
+    std::vector<std::thread> mThreads;
+    std::thread mSupervisor;
+    size_t mRunning = 0;
+    int mWinner = -1;
+    bool mAccepted = false;
+    bool mStopped = false;
+    bool mCancelled = false;
+    bool mTimedOut = false;
+    std::exception_ptr mError;
+};
+
+} // namespace gams
+
+#endif // GAMSSOLVEHANDLEIMPL_H
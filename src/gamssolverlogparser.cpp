@@ -0,0 +1,86 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamssolverlogparser.h"
+#include <cstdlib>
+#include <sstream>
+#include <vector>
+
+using namespace std;
+
+namespace gams {
+
+static bool toDouble(const string &token, double &value)
+{
+    char *end = nullptr;
+    double val = strtod(token.c_str(), &end);
+    if (end == token.c_str() || *end != '\0')
+        return false;
+    value = val;
+    return true;
+}
+
+static bool isCount(const string &token)
+{
+    return token.find_first_not_of("0123456789") == string::npos;
+}
+
+void GAMSSolverLogParser::parse(const string &line, GAMSSolverProgress &progress)
+{
+    if (line.find("Best Integer") != string::npos && line.find("Best Bound") != string::npos) {
+        mLayout = BestIntegerBestBoundItCntGap;
+        return;
+    }
+    if (line.find("Incumbent") != string::npos && line.find("BestBd") != string::npos) {
+        mLayout = IncumbentBestBdGap;
+        return;
+    }
+    if (mLayout == Unknown)
+        return;
+
+    // node log rows end with the relative gap, the values are located in front of it
+    vector<string> tokens;
+    istringstream stream(line);
+    string token;
+    int gap = -1;
+    while (stream >> token) {
+        if (token.back() == '%')
+            gap = static_cast<int>(tokens.size());
+        tokens.push_back(token);
+    }
+    int offset = 2;
+    // rows of heuristic solutions have no iteration count, the token in front of the gap is the bound
+    if (mLayout == BestIntegerBestBoundItCntGap && gap > 0 && isCount(tokens[gap - 1]))
+        offset = 3;
+    if (gap < offset)
+        return;
+    double incumbent, bestBound;
+    if (toDouble(tokens[gap - offset], incumbent) && toDouble(tokens[gap - offset + 1], bestBound)) {
+        progress.incumbent = incumbent;
+        progress.bestBound = bestBound;
+    }
+}
+
+} // namespace gams
@@ -0,0 +1,56 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSOLVERLOGPARSER_H
+#define GAMSSOLVERLOGPARSER_H
+
+#include "gamssolverprogress.h"
+#include <string>
+
+namespace gams {
+
+/// Extracts incumbent and best bound from the node log of a MIP solver.
+class GAMSSolverLogParser
+{
+public:
+    /// Update the progress with a line of the solver log.
+    /// \param line Log line without line break.
+    /// \param progress Progress to update.
+    void parse(const std::string &line, GAMSSolverProgress &progress);
+
+private:
+    /// Columns of the node log relative to the gap column
+    enum Layout
+    {
+        Unknown,
+        BestIntegerBestBoundItCntGap,   ///< CPLEX style, rows of heuristic solutions lack ItCnt
+        IncumbentBestBdGap              ///< Gurobi style
+    };
+    Layout mLayout = Unknown;
+};
+
+} // namespace gams
+
+#endif // GAMSSOLVERLOGPARSER_H
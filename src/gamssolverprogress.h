@@ -0,0 +1,48 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSOLVERPROGRESS_H
+#define GAMSSOLVERPROGRESS_H
+
+#include "gamslib_global.h"
+#include <chrono>
+#include <limits>
+
+namespace gams {
+
+/// Progress of a running GAMSModelInstance solve, passed to a GAMSModelInstance::SolverLogHandler.
+/// \remark Incumbent and best bound are parsed from the node log of MIP solvers with a CPLEX or
+///         Gurobi style layout. They stay NaN for other solvers or as long as no value has been reported.
+struct LIBSPEC GAMSSolverProgress
+{
+    std::chrono::milliseconds elapsed = std::chrono::milliseconds::zero();      ///< Time since the solver has been called
+    double incumbent = std::numeric_limits<double>::quiet_NaN();                ///< Objective value of the best solution found
+    double bestBound = std::numeric_limits<double>::quiet_NaN();                ///< Best bound on the objective value
+    int lines = 0;                                                              ///< Number of log lines written by the solver
+};
+
+} // namespace gams
+
+#endif // GAMSSOLVERPROGRESS_H
@@ -298,6 +298,7 @@ void *GAMSSymbol::symPtr() const
 bool GAMSSymbol::clear()
 {
     if (!mImpl) throw GAMSException("GAMSSymbol: The symbol has not been initialized.");
+    mImpl->markChanged();
     return (1 == gmdClearSymbol(mImpl->gmd(), mImpl->symPtr()));
 }
 
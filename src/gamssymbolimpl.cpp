@@ -169,6 +169,7 @@ GAMSSymbolRecord GAMSSymbolImpl::addRecord(const GAMSSymbol& sym, const std::vec
     void* symIterPtr = 0;
 
     checkForGMDError(gmdAddRecord(gmd(), mSymPtr, mIndexC.set(keys).cPtrs(), &symIterPtr), __FILE__, __LINE__);
+    markChanged(symIterPtr);
     return checkAndReturnRecord(sym, symIterPtr);
 }
 
@@ -182,6 +183,7 @@ GAMSSymbolRecord GAMSSymbolImpl::addRecord(const GAMSSymbol& sym, const string&
     void* symIterPtr = 0;
 
     checkForGMDError(gmdAddRecord(gmd(), mSymPtr, cPtr, &symIterPtr), __FILE__, __LINE__);
+    markChanged(symIterPtr);
     return checkAndReturnRecord(sym, symIterPtr);
 }
 
@@ -193,6 +195,8 @@ void GAMSSymbolImpl::deleteRecord(const std::vector<string>& keys)
     void* symIterPtr = 0;
     if (!gmdFindRecord(gmd(), mSymPtr, mIndexC.set(keys).cPtrs(), &symIterPtr))
         throw GAMSException("Cannot identify record for deletion");
+    // the keys as stored in GMD, the record is gone afterwards
+    markChanged(symIterPtr);
     checkForGMDError(gmdDeleteRecord(gmd(), symIterPtr), __FILE__, __LINE__);
     checkForGMDError(gmdFreeSymbolIterator(gmd(), symIterPtr), __FILE__, __LINE__);
 }
@@ -214,6 +218,7 @@ GAMSSymbolRecord GAMSSymbolImpl::mergeRecord(const GAMSSymbol& sym, const std::v
                 k = k.substr(0, k.size() - 2);
             throw GAMSException("Record '" + k + "' could neither be found in nor added to symbol '" + mName + "'");
         }
+        markChanged(symIterPtr);
     }
     return checkAndReturnRecord(sym, symIterPtr);
 }
@@ -262,6 +267,7 @@ void GAMSSymbolImpl::copySymbol(const GAMSSymbolImpl& target)
     if (target.recordLock())
         throw GAMSException("Cannot add data records to record-locked database");
     checkForGMDError(gmdCopySymbol(gmd(), target.mSymPtr, mSymPtr), __FILE__, __LINE__);
+    target.markChanged();
 }
 
 int GAMSSymbolImpl::numberRecords()
@@ -144,6 +144,10 @@ public:
     bool recordLock() const;
     gmdHandle_t gmd() const;
     void* symPtr();
+    /// Mark the records of this symbol as modified
+    void markChanged() const;
+    /// Mark the record of a symbol iterator as modified
+    void markChanged(void *symIterPtr) const;
 
     GAMSDatabase mDatabase;
     std::string mName;
@@ -70,4 +70,25 @@ bool GAMSSymbolImpl::recordLock() const
     return mDatabase.mImpl->recordLock();
 }
 
+void GAMSSymbolImpl::markChanged() const
+{
+    if (!mDatabase.isValid())
+        throw GAMSException("GAMSSymbolImpl: the database has not been initialized");
+    mDatabase.mImpl->symbolChanged(mSymPtr);
+}
+
+void GAMSSymbolImpl::markChanged(void *symIterPtr) const
+{
+    if (!mDatabase.isValid())
+        throw GAMSException("GAMSSymbolImpl: the database has not been initialized");
+    // the keys are only looked up for symbols used by a model instance
+    if (!mDatabase.mImpl->tracksChanges(mSymPtr))
+        return;
+    gdxStrIndex_t keyData;
+    gdxStrIndexPtrs_t keyPtrs;
+    GDXSTRINDEXPTRS_INIT(keyData, keyPtrs);
+    mDatabase.mImpl->checkForGMDError(gmdGetKeys(gmd(), symIterPtr, mDim, keyPtrs), __FILE__, __LINE__);
+    mDatabase.mImpl->recordChanged(mSymPtr, vector<string>(keyPtrs, keyPtrs + mDim));
+}
+
 }
@@ -78,6 +78,7 @@ void GAMSSymbolRecordImpl::setText(const std::string& text)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetElemText(mSymbol.mImpl->gmd(), mSymIterPtr, text.c_str()),
                                     __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::level()
@@ -90,6 +91,7 @@ double GAMSSymbolRecordImpl::level()
 void GAMSSymbolRecordImpl::setLevel(const double val)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetLevel(mSymbol.mImpl->gmd(), mSymIterPtr, val), __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::marginal()
@@ -102,6 +104,7 @@ double GAMSSymbolRecordImpl::marginal()
 void GAMSSymbolRecordImpl::setMarginal(const double val)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetMarginal(mSymbol.mImpl->gmd(), mSymIterPtr, val), __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::upper()
@@ -114,6 +117,7 @@ double GAMSSymbolRecordImpl::upper()
 void GAMSSymbolRecordImpl::setUpper(const double val)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetUpper(mSymbol.mImpl->gmd(), mSymIterPtr, val), __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::lower()
@@ -126,6 +130,7 @@ double GAMSSymbolRecordImpl::lower()
 void GAMSSymbolRecordImpl::setLower(const double val)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetLower(mSymbol.mImpl->gmd(), mSymIterPtr, val), __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::scale()
@@ -138,6 +143,7 @@ double GAMSSymbolRecordImpl::scale()
 void GAMSSymbolRecordImpl::setScale(const double val)
 {
     mSymbol.mImpl->checkForGMDError(gmdSetScale(mSymbol.mImpl->gmd(), mSymIterPtr, val), __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 double GAMSSymbolRecordImpl::value()
@@ -153,6 +159,7 @@ void GAMSSymbolRecordImpl::setValue(const double val)
 {
     int rc = gmdSetLevel(mSymbol.mImpl->gmd(),mSymIterPtr, val);
     mSymbol.mImpl->checkForGMDError(rc, __FILE__, __LINE__);
+    mSymbol.mImpl->markChanged(mSymIterPtr);
 }
 
 
@@ -0,0 +1,86 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "gamssysteminfo.h"
+#include "gamsplatform.h"
+#include "gamsversion.h"
+#include <cstdlib>
+
+using namespace std;
+
+namespace gams {
+
+mutex GAMSSystemInfo::mLock;
+unordered_map<string, GAMSSystemInfo::SystemDir> GAMSSystemInfo::mSystemDirs;
+string GAMSSystemInfo::mFoundEnv;
+string GAMSSystemInfo::mFoundGams;
+bool GAMSSystemInfo::mFound = false;
+
+string GAMSSystemInfo::findGams(LogId logId)
+{
+    const char *path = getenv("PATH");
+    const char *libPath = cLibEnv[0] ? getenv(cLibEnv) : nullptr;
+    string env = string(path ? path : "") + '\n' + (libPath ? libPath : "");
+
+    lock_guard<mutex> lck(mLock);
+    if (!mFound || mFoundEnv != env) {
+        mFoundGams = GAMSPlatform::findGams(logId);
+        mFoundEnv = env;
+        mFound = true;
+    }
+    return mFoundGams;
+}
+
+bool GAMSSystemInfo::probe(const string &systemDir, string &version)
+{
+    // different spellings of the same directory share one entry
+    error_code ec;
+    string key = filesystem::weakly_canonical(systemDir, ec).string();
+    if (ec)
+        key = systemDir;
+    filesystem::file_time_type stampTime = filesystem::last_write_time(filesystem::path(key) / "gamsstmp.txt", ec);
+    if (ec)
+        stampTime = filesystem::file_time_type::min();
+
+    lock_guard<mutex> lck(mLock);
+    auto it = mSystemDirs.find(key);
+    if (it != mSystemDirs.end() && it->second.stampTime == stampTime) {
+        version = it->second.version;
+        return false;
+    }
+    // the path is only extended on the first probe, so repeated workspaces don't grow it
+    if (it == mSystemDirs.end())
+        GAMSPlatform::ensureEnvPathContains(systemDir.c_str());
+    SystemDir &dir = mSystemDirs[key];
+    dir.version = GAMSVersion::systemVersion(systemDir);
+    dir.stampTime = stampTime;
+    version = dir.version;
+    return true;
+}
+
+GAMSSystemInfo::GAMSSystemInfo()
+{}
+
+} // namespace gams
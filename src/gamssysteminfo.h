@@ -0,0 +1,75 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef GAMSSYSTEMINFO_H
+#define GAMSSYSTEMINFO_H
+
+#include <string>
+#include <mutex>
+#include <unordered_map>
+#include <filesystem>
+#include "gamslog.h"
+
+namespace gams {
+
+/// Process-wide cache of the facts probed from GAMS system directories.
+/// Workspaces of the same system directory share the result of the first probe, as long as
+/// the environment paths and the version stamp file of the system directory do not change.
+/// System directories are compared by their canonical paths.
+class GAMSSystemInfo
+{
+public:
+    /// Find the GAMS system directory in the environment, see GAMSPlatform::findGams.
+    /// \param logId GAMS log ID.
+    /// \return Returns the system directory found for the current environment paths.
+    static std::string findGams(LogId logId = 0);
+
+    /// Check a system directory and add it to the environment path of the process.
+    /// \param systemDir Packed GAMS system directory.
+    /// \param version Set to the GAMS version of the system directory (empty if it could not be determined).
+    /// \return Returns <c>true</c> if the system directory has been probed by this call;
+    ///         <c>false</c> if the cached facts are still valid.
+    static bool probe(const std::string &systemDir, std::string &version);
+
+private:
+    GAMSSystemInfo();
+
+    struct SystemDir
+    {
+        std::string version;
+        std::filesystem::file_time_type stampTime;
+    };
+
+    static std::mutex mLock;
+    static std::unordered_map<std::string, SystemDir> mSystemDirs;
+    /// Environment paths and system directory of the last search
+    static std::string mFoundEnv;
+    static std::string mFoundGams;
+    static bool mFound;
+};
+
+} // namespace gams
+
+#endif // GAMSSYSTEMINFO_H
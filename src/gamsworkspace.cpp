@@ -418,6 +418,91 @@ void GAMSWorkspace::setScratchFilePrefix(const string &prefix)
     mImpl->setScratchFilePrefix(prefix);
 }
 
+bool GAMSWorkspace::compileCache() const
+{
+    return mImpl->compileCache();
+}
+
+void GAMSWorkspace::setCompileCache(bool enabled)
+{
+    mImpl->setCompileCache(enabled);
+}
+
+bool GAMSWorkspace::optionFileCache() const
+{
+    return mImpl->optionFileCache();
+}
+
+void GAMSWorkspace::setOptionFileCache(bool enabled)
+{
+    mImpl->setOptionFileCache(enabled);
+}
+
+bool GAMSWorkspace::instantiationCache() const
+{
+    return mImpl->instantiationCache();
+}
+
+void GAMSWorkspace::setInstantiationCache(bool enabled)
+{
+    mImpl->setInstantiationCache(enabled);
+}
+
+string GAMSWorkspace::modelInstanceDirectory() const
+{
+    return mImpl->modelInstanceDirectory();
+}
+
+void GAMSWorkspace::setModelInstanceDirectory(const string &directory)
+{
+    mImpl->setModelInstanceDirectory(directory);
+}
+
+int GAMSWorkspace::scratchFileRetentionCount() const
+{
+    return mImpl->scratchCleaner().retentionCount();
+}
+
+void GAMSWorkspace::setScratchFileRetentionCount(int count)
+{
+    mImpl->scratchCleaner().setRetentionCount(count);
+}
+
+uint64_t GAMSWorkspace::scratchFileRetentionBytes() const
+{
+    return mImpl->scratchCleaner().retentionBytes();
+}
+
+void GAMSWorkspace::setScratchFileRetentionBytes(uint64_t bytes)
+{
+    mImpl->scratchCleaner().setRetentionBytes(bytes);
+}
+
+int GAMSWorkspace::cleanScratchFiles()
+{
+    return mImpl->scratchCleaner().clean();
+}
+
+bool GAMSWorkspace::collectJobStats() const
+{
+    return mImpl->collectJobStats();
+}
+
+void GAMSWorkspace::setCollectJobStats(bool enabled)
+{
+    mImpl->setCollectJobStats(enabled);
+}
+
+std::vector<int> GAMSWorkspace::jobStatsHistogram(GAMSJobStats::Phase phase) const
+{
+    return mImpl->jobStatsHistogram(phase);
+}
+
+void GAMSWorkspace::resetJobStatsHistogram()
+{
+    mImpl->resetJobStatsHistogram();
+}
+
 double GAMSWorkspace::myEPS()
 {
     return mImpl->specValues[GMS_SVIDX_EPS];
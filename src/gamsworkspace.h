@@ -27,9 +27,12 @@
 #define GAMSWORKSPACE_H
 
 #include <memory>
+#include <cstdint>
 #include "gamslib_global.h"
 #include "gamsenum.h"
 #include "gamsworkspaceinfo.h"
+#include "gamsjobstats.h"
+#include <vector>
 
 namespace gams {
 
@@ -85,6 +88,9 @@ class GAMSJob;
 /// <p>This avoids the automatic identification of the GAMS system directory but might be the
 /// most convenient solution for systems running multiple applications using different versions
 /// of the GAMS C++ API together with different versions of GAMS.</p>
+/// <p>The GAMS version of a system directory is checked once per process. A warning about a
+/// version mismatch is only issued by the first GAMSWorkspace using the directory, or by the
+/// first one after the GAMS installation in it has been updated.</p>
 class LIBSPEC GAMSWorkspace
 {
 public:
@@ -168,6 +174,117 @@ public:
     /// \param prefix String used to prefix automatically generated files.
     void setScratchFilePrefix(const std::string &prefix);
 
+    /// Check if jobs created by addJobFromString are compiled only once per model source.
+    bool compileCache() const;
+
+    /// Enable or disable the compile cache for jobs created by addJobFromString afterwards.
+    /// <p>With the cache enabled, the first run of a model source compiles it into a work file
+    /// (<c>action=C</c>) that is kept in the working directory. All following runs of the same
+    /// source restart from this work file and only execute it (<c>action=E</c>). The cache is
+    /// keyed by the source text, the compile-relevant GAMS options (e.g. <c>--</c> defines), the
+    /// start GAMSCheckpoint and the GAMS version, so any change of these compiles the model again.</p>
+    /// <p>Data read at compile time would be frozen in the work file. Sources using compile-time
+    /// file access like <c>$gdxIn</c> or <c>$include</c> are therefore never cached; load changing
+    /// data at execution time (e.g. with <c>execute_load</c>) to benefit from the cache.</p>
+    /// <p>The work files written by this workspace are removed together with the workspace unless
+    /// the debug level keeps files.</p>
+    /// \param enabled Flag to enable the cache.
+    /// \remark Default is <c>false</c>.
+    void setCompileCache(bool enabled);
+
+    /// Check if local GAMSJob runs with identical options share one option file.
+    bool optionFileCache() const;
+
+    /// Enable or disable sharing of option files between local GAMSJob runs.
+    /// <p>With the cache enabled, the options specific to a single run (input file, log file,
+    /// result GDX file, save and restart checkpoints, etc.) are passed on the command line
+    /// and all other options are kept in an option file named after the hash of its content.
+    /// Runs with identical options reuse this file instead of leaving one option file per job
+    /// in the working directory; a job does not write an option file of its own. The shared option
+    /// files written by this workspace are removed together with the workspace unless the debug
+    /// level keeps files.</p>
+    /// \param enabled Flag to enable the cache.
+    /// \remark Default is <c>false</c>.
+    void setOptionFileCache(bool enabled);
+
+    /// Check if instantiated model instances are cached.
+    bool instantiationCache() const;
+
+    /// Enable or disable the cache of instantiated model instances.
+    /// <p>GAMSModelInstance::instantiate runs GAMS to generate the model into a scratch
+    /// directory. With the cache enabled, a copy of this scratch directory is kept in the
+    /// working directory. Later instances of the same checkpoint, model definition, parameter
+    /// modifiers and GAMS options are initialized from the copy, the way
+    /// GAMSModelInstance::copyModelInstance does, instead of running GAMS again.</p>
+    /// \param enabled Flag to enable the cache.
+    /// \remark Default is <c>false</c>.
+    void setInstantiationCache(bool enabled);
+
+    /// Get the directory holding the scratch directories of model instances.
+    /// \return Returns the directory or an empty string if they are located in the working directory.
+    std::string modelInstanceDirectory() const;
+
+    /// Set the directory holding the scratch directories of model instances created afterwards.
+    /// <p>Every GAMSModelInstance, including copies made by GAMSModelInstance::copyModelInstance,
+    /// has a scratch directory with the generated model. Placing these on a fast file system like
+    /// a tmpfs (e.g. <c>/dev/shm</c>) avoids the I/O of a slow or network-backed working directory.
+    /// The scratch directories are created in a unique subdirectory and are removed together with
+    /// the model instance unless the debug level keeps files.</p>
+    /// \param directory Directory for the scratch directories; an empty string uses the working directory.
+    /// \remark Default is an empty string.
+    void setModelInstanceDirectory(const std::string &directory);
+
+    /// Get the number of released jobs and databases whose scratch files are kept.
+    /// \return Returns the number or -1 if all scratch files are kept.
+    int scratchFileRetentionCount() const;
+
+    /// Set the number of released jobs and databases whose scratch files are kept.
+    /// <p>A GAMSJob leaves its generated source, parameter, log, listing and result GDX files in the
+    /// working directory, a GAMSDatabase used by a job the exported GDX file. Once a retention
+    /// policy is set, these files are tracked and a background thread of the workspace removes the
+    /// files of the oldest jobs and databases which are no longer referenced, so that the most recent
+    /// ones stay within the retention count and the retention bytes. Files of jobs and databases
+    /// which are still referenced, files passed in by the user and checkpoints are never removed.
+    /// Files of failed jobs are not removed if the debug level is KeepFilesOnError or higher, no files
+    /// are removed if the debug level is KeepFiles or higher.</p>
+    /// \param count Number of released jobs and databases with kept files; a negative value keeps all.
+    /// \remark Default is -1.
+    void setScratchFileRetentionCount(int count);
+
+    /// Get the number of bytes of scratch files kept for released jobs and databases.
+    /// \return Returns the number of bytes or 0 if the size is not limited.
+    std::uint64_t scratchFileRetentionBytes() const;
+
+    /// Set the number of bytes of scratch files kept for released jobs and databases.
+    /// <p>See setScratchFileRetentionCount for the files affected.</p>
+    /// \param bytes Number of bytes; 0 does not limit the size.
+    /// \remark Default is 0.
+    void setScratchFileRetentionBytes(std::uint64_t bytes);
+
+    /// Remove the scratch files exceeding the retention policy now instead of waiting for the
+    /// background thread.
+    /// \return Returns the number of removed files.
+    int cleanScratchFiles();
+
+    /// Check if the statistics of all GAMSJob runs of this workspace are collected in histograms.
+    bool collectJobStats() const;
+
+    /// Enable or disable collecting the statistics of all GAMSJob runs of this workspace.
+    /// \param enabled Flag to enable collecting.
+    /// \remark Default is <c>false</c>.
+    void setCollectJobStats(bool enabled);
+
+    /// Get the histogram of the time spent in one phase of the collected GAMSJob runs.
+    /// Bucket 0 counts the runs that spent less than 1 microsecond in the phase, bucket i counts
+    /// the runs that spent at least 2^(i-1) and less than 2^i microseconds. The last bucket also
+    /// counts all longer runs.
+    /// \param phase Phase of the GAMSJob runs.
+    /// \return Returns the number of runs per bucket.
+    std::vector<int> jobStatsHistogram(GAMSJobStats::Phase phase) const;
+
+    /// Clear the histograms of the collected GAMSJob runs.
+    void resetJobStatsHistogram();
+
     /// Get value to be stored in and read from GAMSDatabase for Epsilon.
     /// \remark Default is numeric_limits<double>::min().
     double myEPS();
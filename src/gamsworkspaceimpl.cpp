@@ -35,12 +35,15 @@
 #include <limits>
 #include <string.h>
 #include <array>
+#include <regex>
 
 #include "gamslog.h"
 #include "gamsworkspaceimpl.h"
+#include "gamsjobimpl.h"
 #include "gamsplatform.h"
 #include "gamsoptions.h"
 #include "gamsworkspacepool.h"
+#include "gamssysteminfo.h"
 #include "gclgms.h"
 
 using namespace std;
@@ -105,7 +108,7 @@ GAMSWorkspaceImpl::GAMSWorkspaceImpl(const string& workingDir, const string& sys
     GAMSWorkspacePool::registerWorkspacePath(mWorkingDir.toStdString());
 
     // handle system directory
-    mSystemDir = systemDir.empty() ? GAMSPlatform::findGams(logID()) : systemDir;
+    mSystemDir = systemDir.empty() ? GAMSSystemInfo::findGams(logID()) : systemDir;
     if (!mSystemDir.exists()) {
         throw GAMSException("Invalid GAMS system directory: " + systemDir);
     }
@@ -119,7 +122,8 @@ GAMSWorkspaceImpl::GAMSWorkspaceImpl(const string& workingDir, const string& sys
 
     DEB << joat64File.string();
 
-    if (mSystemDir != mWorkingDir) {
+    // a new temporary working directory is empty
+    if (mSystemDir != mWorkingDir && !mUsingTmpWorkingDir) {
         vector<string> libstems = {"gdxdc", "gmdcc", "joatdc", "optdc"};
         for (const string &lib: libstems) {
             ostringstream libstream;
@@ -135,16 +139,17 @@ GAMSWorkspaceImpl::GAMSWorkspaceImpl(const string& workingDir, const string& sys
         }
     }
 
-    GAMSPlatform::ensureEnvPathContains(mSystemDir.c_str());
-    // Check GAMS version of the system directory
+    // Check GAMS version of the system directory, warnings are only issued when it is probed
     string compiledVersion = GAMSVersion::gamsVersion();
-    string systemVersion = GAMSVersion::systemVersion(mSystemDir.toStdString());
-    if (systemVersion.empty()) {
-        MSG << "Warning: The GAMS version at '" << mSystemDir.c_str() << "' could not be determined.";
-    } else if (compiledVersion != systemVersion) {
-        MSG << "\n--- Warning: This library is developed for GAMS version " << compiledVersion << "."
-            << "\n---          The selected system path '" << mSystemDir.c_str() << "' contains GAMS version " << systemVersion << "."
-            << "\n---          This may result in unpredictable behavior.";
+    string systemVersion;
+    if (GAMSSystemInfo::probe(mSystemDir.toStdString(), systemVersion)) {
+        if (systemVersion.empty()) {
+            MSG << "Warning: The GAMS version at '" << mSystemDir.c_str() << "' could not be determined.";
+        } else if (compiledVersion != systemVersion) {
+            MSG << "\n--- Warning: This library is developed for GAMS version " << compiledVersion << "."
+                << "\n---          The selected system path '" << mSystemDir.c_str() << "' contains GAMS version " << systemVersion << "."
+                << "\n---          This may result in unpredictable behavior.";
+        }
     }
 
     // TODO: all the ProcessStartInfo stuff.
@@ -153,9 +158,18 @@ GAMSWorkspaceImpl::GAMSWorkspaceImpl(const string& workingDir, const string& sys
 GAMSWorkspaceImpl::~GAMSWorkspaceImpl()
 {
     DEB << "---- Entering GAMSWorkspaceImpl destructor ----";
+    mScratchCleaner.stop();
     GAMSWorkspacePool::unregisterWorkspacePath(mWorkingDir.toStdString());
-    if (mUsingTmpWorkingDir &&
-        (mDebug == GAMSEnum::DebugLevel::Off || (mDebug == GAMSEnum::DebugLevel::KeepFilesOnError && !mHasError))) {
+    if (removeFiles()) {
+        for (GAMSPath &dir : mInstantiationDirs)
+            dir.rmDirRecurse();
+        for (GAMSPath &root : mModelInstanceScratchRoots)
+            root.rmDirRecurse();
+        error_code ec;
+        for (const string &file : mCacheFiles)
+            filesystem::remove(file, ec);
+    }
+    if (mUsingTmpWorkingDir && removeFiles()) {
         if ( (mWorkingDir.rmDirRecurse())) {
             MSG << "Error on cleaning workspace.";
         }
@@ -176,59 +190,27 @@ bool GAMSWorkspaceImpl::operator!=(const GAMSWorkspaceImpl& other) const
 
 string GAMSWorkspaceImpl::registerCheckpoint(const string &checkpointName)
 {
-    lock_guard<std::mutex> lck(mCheckpointLock);
-    string name = "";
-    if (checkpointName.empty()) {
-        name = mScratchFilePrefix + mDefCheckpointNameStem + to_string(mDefCheckpointNameCnt);
-        while (mGamsCheckpoints.find(name) != mGamsCheckpoints.end())
-            name = mScratchFilePrefix + mDefCheckpointNameStem + to_string(++mDefCheckpointNameCnt);
-
-        mDefCheckpointNameCnt++;
-    } else {
-        name = checkpointName;
-    }
-    auto res = mGamsCheckpoints.insert(name);
-    if (!res.second)
-        throw GAMSException("GAMSWorkspaceImpl: checkpoint '" + name + "' already exists");
+    string name = mGamsCheckpoints.add(checkpointName, mScratchFilePrefix);
+    if (name.empty())
+        throw GAMSException("GAMSWorkspaceImpl: checkpoint '" + checkpointName + "' already exists");
     return name;
 }
 
 
 string GAMSWorkspaceImpl::registerModelInstance(const string &miName)
 {
-    lock_guard<std::mutex> lck(mModelInstanceLock);
-    string name;
-    if (miName == "") {
-        name = mScratchFilePrefix + mDefModeliNameStem + to_string(mDefModeliNameCnt);
-        while (mGamsModelInstances.find(name) != mGamsModelInstances.end())
-            name = mScratchFilePrefix + mDefModeliNameStem + to_string(++mDefModeliNameCnt);
-
-        mDefModeliNameCnt++;
-    } else {
-        name = miName;
-    }
-    auto res = mGamsModelInstances.insert(name);
-    if (!res.second)
-        throw GAMSException("GAMSWorkspaceImpl: model-instance '" + name + "' already exists");
+    string name = mGamsModelInstances.add(miName, mScratchFilePrefix);
+    if (name.empty())
+        throw GAMSException("GAMSWorkspaceImpl: model-instance '" + miName + "' already exists");
     return name;
 }
 
 
 string GAMSWorkspaceImpl::registerJob(const string &jobName)
 {
-    lock_guard<std::mutex> lck(mJobLock);
-    string name;
-    if (jobName == "") {
-        name = mScratchFilePrefix + mDefJobNameStem + to_string(mDefJobNameCnt);
-        while (mGamsJobs.find(name) != mGamsJobs.end())
-            name = mScratchFilePrefix + mDefJobNameStem + to_string(++mDefJobNameCnt);
-        mDefJobNameCnt++;
-    } else {
-        name = jobName;
-    }
-    auto res = mGamsJobs.insert(name);
-    if (!res.second)
-        throw GAMSException("GAMSWorkspaceImpl: job '" + name + "' already exists");
+    string name = mGamsJobs.add(jobName, mScratchFilePrefix);
+    if (name.empty())
+        throw GAMSException("GAMSWorkspaceImpl: job '" + jobName + "' already exists");
     return name;
 }
 
@@ -303,7 +285,11 @@ GAMSJob GAMSWorkspaceImpl::addJobFromString(GAMSWorkspace& ws, const string& gam
     if (jName.empty())
        throw GAMSException("Job with name " + jobName + " already exists");
     string fName = writeSource(gamsSource, jName);
-    return GAMSJob(ws, jName, fName, nullptr);
+    GAMSJob job(ws, jName, fName, nullptr);
+    job.mImpl->mScratchSource = true;
+    if (mCompileCache && isCacheableSource(gamsSource))
+        job.mImpl->mSourceHash = GAMSPlatform::contentHash(gamsSource);
+    return job;
 }
 
 GAMSJob GAMSWorkspaceImpl::addJobFromString(GAMSWorkspace& ws, const string& gamsSource, const GAMSCheckpoint& checkpoint, const string& jobName)
@@ -312,7 +298,11 @@ GAMSJob GAMSWorkspaceImpl::addJobFromString(GAMSWorkspace& ws, const string& gam
     if (jName.empty())
        throw GAMSException("Job with name " + jobName + " already exists");
     string fName = writeSource(gamsSource, jName);
-    return GAMSJob(ws, jName, fName, &checkpoint);
+    GAMSJob job(ws, jName, fName, &checkpoint);
+    job.mImpl->mScratchSource = true;
+    if (mCompileCache && isCacheableSource(gamsSource))
+        job.mImpl->mSourceHash = GAMSPlatform::contentHash(gamsSource);
+    return job;
 }
 
 GAMSDatabase GAMSWorkspaceImpl::addDatabase(GAMSWorkspace& ws, const string& databaseName, const string& inModelName)
@@ -351,6 +341,123 @@ void GAMSWorkspaceImpl::xxxLib(const string &libname, const string &model)
         throw GAMSException(libname + "lib return code not 0 (" + to_string(exitCode) + ")");
 }
 
+void GAMSWorkspaceImpl::recordJobStats(const GAMSJobStats &stats)
+{
+    if (!mCollectJobStats)
+        return;
+    lock_guard<mutex> lck(mJobStatsLock);
+    for (int phase = 0; phase < GAMSJobStats::cPhaseCount; ++phase)
+        mJobStatsHistogram[phase][jobStatsBucket(stats.time(GAMSJobStats::Phase(phase)))]++;
+}
+
+void GAMSWorkspaceImpl::amendJobStats(const GAMSJobStats &before, const GAMSJobStats &after)
+{
+    if (!mCollectJobStats)
+        return;
+    lock_guard<mutex> lck(mJobStatsLock);
+    for (int phase = 0; phase < GAMSJobStats::cPhaseCount; ++phase) {
+        int &old = mJobStatsHistogram[phase][jobStatsBucket(before.time(GAMSJobStats::Phase(phase)))];
+        // the histogram may have been reset in between
+        if (old > 0) {
+            old--;
+            mJobStatsHistogram[phase][jobStatsBucket(after.time(GAMSJobStats::Phase(phase)))]++;
+        }
+    }
+}
+
+int GAMSWorkspaceImpl::jobStatsBucket(chrono::nanoseconds time)
+{
+    auto us = chrono::duration_cast<chrono::microseconds>(time).count();
+    int bucket = 0;
+    while (us > 0 && bucket < cJobStatsBuckets - 1) {
+        us >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+vector<int> GAMSWorkspaceImpl::jobStatsHistogram(GAMSJobStats::Phase phase)
+{
+    lock_guard<mutex> lck(mJobStatsLock);
+    return vector<int>(mJobStatsHistogram[phase].begin(), mJobStatsHistogram[phase].end());
+}
+
+void GAMSWorkspaceImpl::resetJobStatsHistogram()
+{
+    lock_guard<mutex> lck(mJobStatsLock);
+    for (auto &histogram : mJobStatsHistogram)
+        histogram.fill(0);
+}
+
+string GAMSWorkspaceImpl::cachedInstantiation(const string &key)
+{
+    lock_guard<mutex> lck(mInstantiationCacheLock);
+    auto it = mInstantiations.find(key);
+    return it == mInstantiations.end() ? string() : it->second;
+}
+
+void GAMSWorkspaceImpl::addCachedInstantiation(const string &key, const string &controlFile,
+                                               const GAMSPath &directory)
+{
+    lock_guard<mutex> lck(mInstantiationCacheLock);
+    mInstantiations.emplace(key, controlFile);
+    mInstantiationDirs.push_back(directory);
+}
+
+string GAMSWorkspaceImpl::modelInstanceDirectory()
+{
+    lock_guard<mutex> lck(mModelInstanceDirLock);
+    return mModelInstanceDir;
+}
+
+void GAMSWorkspaceImpl::setModelInstanceDirectory(const string &directory)
+{
+    lock_guard<mutex> lck(mModelInstanceDirLock);
+    if (directory == mModelInstanceDir)
+        return;
+    mModelInstanceDir = directory;
+    mModelInstanceScratchRoot = GAMSPath();
+}
+
+GAMSPath GAMSWorkspaceImpl::modelInstanceScratchRoot()
+{
+    lock_guard<mutex> lck(mModelInstanceDirLock);
+    if (mModelInstanceDir.empty())
+        return mWorkingDir;
+    if (mModelInstanceScratchRoot.empty()) {
+        GAMSPath root = mWorkingDir.tempDir(mModelInstanceDir);
+        if (!root.exists())
+            throw GAMSException("Cannot create model instance directory in " + mModelInstanceDir);
+        mModelInstanceScratchRoot = root;
+        mModelInstanceScratchRoots.push_back(root);
+    }
+    return mModelInstanceScratchRoot;
+}
+
+void GAMSWorkspaceImpl::addCacheFile(const string &file)
+{
+    lock_guard<mutex> lck(mCacheFilesLock);
+    mCacheFiles.push_back(file);
+}
+
+bool GAMSWorkspaceImpl::removeFiles()
+{
+    return mDebug == GAMSEnum::DebugLevel::Off || (mDebug == GAMSEnum::DebugLevel::KeepFilesOnError && !mHasError);
+}
+
+bool GAMSWorkspaceImpl::isCacheableSource(const string &gamsSource)
+{
+    // dollar control options reading or writing files or running programs at compile time; no word
+    // boundary, so variants like $loadIdx, $onEchoV or $echoN are matched as well
+    static const regex compileTimeAccess("\\$\\s*(gdxin|gdxout|gdxload|load|unload|"
+                                         "include|batinclude|libinclude|sysinclude|call|hiddencall|"
+                                         "execute|onembeddedcode|embeddedcode|onecho|echo|onput|import|"
+                                         "read|funclibin)", regex::icase);
+    // conditions on the existence of files and directories
+    static const regex existenceCheck("\\$\\s*(else)?if(then)?[ie]?\\s+(not\\s+)?d?exist\\b", regex::icase);
+    return !regex_search(gamsSource, compileTimeAccess) && !regex_search(gamsSource, existenceCheck);
+}
+
 void GAMSWorkspaceImpl::setScratchFilePrefix(const string& scratchFilePrefix)
 {
     if (scratchFilePrefix.find_first_of("\t\n ")!=string::npos)
@@ -361,26 +468,15 @@ void GAMSWorkspaceImpl::setScratchFilePrefix(const string& scratchFilePrefix)
 
 string GAMSWorkspaceImpl::registerDatabase(const string &databaseName)
 {
-    lock_guard<std::mutex> lck(mRegisterDatabaseLock);
-    string name;
-    if (databaseName == "")
-        name = nextDatabaseName();
-    else
-        name = databaseName;
-    auto res = mGamsDatabases.insert(name);
-    if (!res.second)
-        throw GAMSException("GAMSWorkspaceImpl: database '" + name + "' already exists");
+    string name = mGamsDatabases.add(databaseName, mScratchFilePrefix);
+    if (name.empty())
+        throw GAMSException("GAMSWorkspaceImpl: database '" + databaseName + "' already exists");
     return name;
 }
 
 string GAMSWorkspaceImpl::nextDatabaseName()
 {
-    lock_guard<std::mutex> lck(mNextDatabaseNameLock);
-    string name = mScratchFilePrefix + mDefDBNameStem + to_string(mDefDBNameCnt);
-    while (mGamsDatabases.find(name) != mGamsDatabases.end())
-        name = mScratchFilePrefix + mDefDBNameStem + to_string(++mDefDBNameCnt);
-    mDefDBNameCnt++;
-    return name;
+    return mGamsDatabases.next(mScratchFilePrefix);
 }
 
 
@@ -27,15 +27,22 @@
 #define GAMSWORKSPACEIMPL_H
 
 #include <string>
-#include <set>
+#include <map>
 #include "gamscheckpoint.h"
 #include "gamsdatabase.h"
 #include "gamsjob.h"
 #include "gamsenum.h"
 #include "gamspath.h"
 #include "gamsversion.h"
+#include "gamsjobstats.h"
+#include "gamsnameregistry.h"
+#include "gamshandlepool.h"
+#include "gamsscratchcleaner.h"
 
+#include <atomic>
 #include <mutex>
+#include <array>
+#include <vector>
 
 namespace gams
 {
@@ -134,11 +141,60 @@ public:
     std::string scratchFilePrefix() const {return mScratchFilePrefix;}
     void setScratchFilePrefix(const std::string &scratchFilePrefix);
 
+    bool compileCache() const { return mCompileCache; }
+    void setCompileCache(bool enabled) { mCompileCache = enabled; }
+
+    bool optionFileCache() const { return mOptionFileCache; }
+    void setOptionFileCache(bool enabled) { mOptionFileCache = enabled; }
+
+    bool instantiationCache() const { return mInstantiationCache; }
+    void setInstantiationCache(bool enabled) { mInstantiationCache = enabled; }
+    /// Get the control file of a cached instantiated scratch directory or an empty string
+    std::string cachedInstantiation(const std::string &key);
+    /// Add the control file of an instantiated scratch directory to the cache, the directory is
+    /// removed with the workspace
+    void addCachedInstantiation(const std::string &key, const std::string &controlFile,
+                                const GAMSPath &directory);
+
+    std::string modelInstanceDirectory();
+    void setModelInstanceDirectory(const std::string &directory);
+    /// Get the directory for new model instance scratch directories, creating it on first use
+    GAMSPath modelInstanceScratchRoot();
+    /// Check if the files of the workspace can be removed according to the debug level
+    bool removeFiles();
+
+    bool collectJobStats() const { return mCollectJobStats; }
+    void setCollectJobStats(bool enabled) { mCollectJobStats = enabled; }
+    /// Adds the statistics of a GAMSJob run to the histograms if collecting is enabled
+    void recordJobStats(const GAMSJobStats &stats);
+    /// Replaces recorded statistics of a GAMSJob run by updated ones
+    void amendJobStats(const GAMSJobStats &before, const GAMSJobStats &after);
+    std::vector<int> jobStatsHistogram(GAMSJobStats::Phase phase);
+
+    /// Number of buckets of the time histograms
+    static const int cJobStatsBuckets = 40;
+    /// Get the bucket of a time histogram: 0 below 1 microsecond, otherwise 1 + log2 of the microseconds
+    static int jobStatsBucket(std::chrono::nanoseconds time);
+    void resetJobStatsHistogram();
+
+    /// Checks if a model source can be compiled once and executed many times, i.e. if it
+    /// does not access files at compile time
+    static bool isCacheableSource(const std::string &gamsSource);
+
     std::string optFileExtension(int index);
 
     bool hasError() const;
     void setHasError(bool newHasError);
 
+    /// Handles of the GMD, GEV and GMO libraries used by the objects of this workspace
+    GAMSHandlePool &handlePool() { return mHandlePool; }
+
+    /// Register a file of the compile or option file cache, removed with the workspace
+    void addCacheFile(const std::string &file);
+
+    /// Removes the scratch files of released jobs and databases according to the retention policy
+    GAMSScratchCleaner &scratchCleaner() { return mScratchCleaner; }
+
 private:
 
     GAMSPath mWorkingDir;
@@ -146,31 +202,42 @@ private:
 
     std::string mScratchFilePrefix = "_gams_cpp_";
     bool mUsingTmpWorkingDir = false;
+    std::atomic<bool> mCompileCache{false};
+    std::atomic<bool> mOptionFileCache{false};
+    std::atomic<bool> mInstantiationCache{false};
+    std::atomic<bool> mCollectJobStats{false};
 
     GAMSEnum::DebugLevel mDebug = GAMSEnum::DebugLevel::KeepFilesOnError;
     bool mHasError = false;
 
-    std::set<std::string> mGamsCheckpoints;
-    std::set<std::string> mGamsDatabases;
-    std::set<std::string> mGamsJobs;
-    std::set<std::string> mGamsModelInstances;
+    GAMSNameRegistry mGamsCheckpoints { "gcp" };
+    GAMSNameRegistry mGamsDatabases { "gdb" };
+    GAMSNameRegistry mGamsJobs { "gjo" };
+    GAMSNameRegistry mGamsModelInstances { "gmi" };
 
-    std::mutex mCheckpointLock;
-    std::mutex mRegisterDatabaseLock;
-    std::mutex mNextDatabaseNameLock;
-    std::mutex mJobLock;
-    std::mutex mModelInstanceLock;
     std::mutex mDebugLock;
+    std::mutex mJobStatsLock;
+    std::mutex mInstantiationCacheLock;
+    std::mutex mModelInstanceDirLock;
+
+    std::string mModelInstanceDir;
+    GAMSPath mModelInstanceScratchRoot;
+    /// Unique directories created for model instance scratch directories, removed with the workspace
+    std::vector<GAMSPath> mModelInstanceScratchRoots;
+
+    std::mutex mCacheFilesLock;
+    /// Files written by the compile and option file cache, removed with the workspace
+    std::vector<std::string> mCacheFiles;
+
+    /// Control files of cached instantiated scratch directories by cache key
+    std::map<std::string, std::string> mInstantiations;
+    /// Cached instantiated scratch directories, removed with the workspace
+    std::vector<GAMSPath> mInstantiationDirs;
 
-    int mDefDBNameCnt = 0;
-    int mDefJobNameCnt = 0;
-    int mDefCheckpointNameCnt = 0;
-    int mDefModeliNameCnt = 0;
+    std::array<std::array<int, cJobStatsBuckets>, GAMSJobStats::cPhaseCount> mJobStatsHistogram {};
 
-    std::string mDefDBNameStem = "gdb";
-    std::string mDefJobNameStem = "gjo";
-    std::string mDefCheckpointNameStem = "gcp";
-    std::string mDefModeliNameStem = "gmi";
+    GAMSHandlePool mHandlePool;
+    GAMSScratchCleaner mScratchCleaner;
 };
 
 } // namespace gams
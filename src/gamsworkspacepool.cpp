@@ -23,45 +23,71 @@
  * SOFTWARE.
  */
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <cstdint>
 #include "gamsworkspacepool.h"
 #include "gamsexception.h"
-#include "gamspath.h"
+
+using namespace std;
 
 namespace gams {
 
-std::set<std::string> GAMSWorkspacePool::mWorspacePaths;
+mutex GAMSWorkspacePool::mLock;
+unordered_map<string, string> GAMSWorkspacePool::mWorkspacePaths;
+unordered_map<string, string> GAMSWorkspacePool::mWorkspaceKeys;
 
-void GAMSWorkspacePool::registerWorkspacePath(const std::string& path)
+void GAMSWorkspacePool::registerWorkspacePath(const string& path)
 {
-    // Create unique lockfile in path (throw on missing write access).
-    GAMSPath lockPath = GAMSPath(path).tempFile("gams.lock");
-    if (!lockPath.exists())
-        throw GAMSException("GAMSWorkspacePool: failed to create lockfile in path " + path);
-
-    // Iterate through the paths for the lockfile (throw if exists).
-    for (auto iPath = mWorspacePaths.cbegin(); iPath != mWorspacePaths.cend(); ++iPath) {
-        GAMSPath checkFile = GAMSPath(*iPath) / lockPath.string();
-        if (checkFile.exists()) {
-            lockPath.remove();
-            if (path != *iPath)
-                throw GAMSException("GAMSWorkspacePool: path " + path + " is already in use as " + *iPath);
-            else
-                throw GAMSException("GAMSWorkspacePool: path " + path + " is already in use.");
-        }
+    string key = directoryKey(path);
+    lock_guard<mutex> lck(mLock);
+    auto res = mWorkspacePaths.emplace(key, path);
+    if (!res.second) {
+        const string &usedPath = res.first->second;
+        if (path != usedPath)
+            throw GAMSException("GAMSWorkspacePool: path " + path + " is already in use as " + usedPath);
+        else
+            throw GAMSException("GAMSWorkspacePool: path " + path + " is already in use.");
     }
-    mWorspacePaths.insert(path);
-    // Remove lockfile and add path to paths.
-    lockPath.remove();
+    mWorkspaceKeys[path] = key;
 }
 
-void GAMSWorkspacePool::unregisterWorkspacePath(const std::string& path)
+void GAMSWorkspacePool::unregisterWorkspacePath(const string& path)
 {
-    auto iPath = mWorspacePaths.find(path);
-    if (iPath != mWorspacePaths.end()) {
-        mWorspacePaths.erase(iPath);
+    lock_guard<mutex> lck(mLock);
+    auto iKey = mWorkspaceKeys.find(path);
+    if (iKey != mWorkspaceKeys.end()) {
+        mWorkspacePaths.erase(iKey->second);
+        mWorkspaceKeys.erase(iKey);
     }
 }
 
+string GAMSWorkspacePool::directoryKey(const string& path)
+{
+#ifdef _WIN32
+    HANDLE dir = CreateFileA(path.c_str(), 0, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                             nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+    if (dir == INVALID_HANDLE_VALUE)
+        throw GAMSException("GAMSWorkspacePool: failed to open path " + path);
+    BY_HANDLE_FILE_INFORMATION info;
+    BOOL ok = GetFileInformationByHandle(dir, &info);
+    CloseHandle(dir);
+    if (!ok)
+        throw GAMSException("GAMSWorkspacePool: failed to identify path " + path);
+    uint64_t index = (uint64_t(info.nFileIndexHigh) << 32) | info.nFileIndexLow;
+    return to_string(info.dwVolumeSerialNumber) + ":" + to_string(index);
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+        throw GAMSException("GAMSWorkspacePool: failed to identify path " + path);
+    return to_string(uint64_t(info.st_dev)) + ":" + to_string(uint64_t(info.st_ino));
+#endif
+}
+
 GAMSWorkspacePool::GAMSWorkspacePool()
 {}
 
@@ -27,16 +27,20 @@
 #define GAMSWORKSPACEPOOL_H
 
 #include <string>
-#include <set>
+#include <mutex>
+#include <unordered_map>
 
 namespace gams {
 
 /// Manages a collection of all GAMS workspaces.
+/// Workspace paths are identified by their directory (device and inode, volume and file
+/// index on Windows), so that different spellings of the same directory are detected.
 class GAMSWorkspacePool
 {
 public:
 
     /// Register a GAMS workspace path.
+    /// \remark Throws if the directory of the path is already used by another workspace.
     /// \param path A GAMS workspace path.
     static void registerWorkspacePath(const std::string& path);
 
@@ -46,7 +50,15 @@ public:
 
 private:
     GAMSWorkspacePool();
-    static std::set<std::string> mWorspacePaths;
+
+    /// Get the key identifying the directory of a path
+    static std::string directoryKey(const std::string& path);
+
+    static std::mutex mLock;
+    /// Registered path by directory key
+    static std::unordered_map<std::string, std::string> mWorkspacePaths;
+    /// Directory key by registered path
+    static std::unordered_map<std::string, std::string> mWorkspaceKeys;
 };
 
 } // namespace gams
@@ -37,6 +37,7 @@
 #include "gamspath.h"
 #include <sstream>
 #include <string>
+#include <iostream>
 
 using namespace gams;
 
@@ -174,6 +175,21 @@ TEST_F(TestGAMSDatabase, testGetNrSymbols) {
     EXPECT_EQ( db.getNrSymbols(), 3 );
 }
 
+TEST_F(TestGAMSDatabase, testCreateAndDestroyDatabases) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    const int count = 1000;
+    // when, the libraries stay loaded between the databases
+    for (int i = 0; i < count; ++i) {
+        GAMSDatabase db = ws.addDatabase();
+        // then
+        EXPECT_EQ( db.getNrSymbols(), 0 );
+        getTestData_Set_plants_i(db);
+        EXPECT_EQ( db.getNrSymbols(), 1 );
+    }
+}
+
 TEST_F(TestGAMSDatabase, testGetSuppressAutoDomainChecking) {
     // given
     GAMSWorkspaceInfo wsInfo("", testSystemDir);
@@ -0,0 +1,70 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsexceptiontimeout.h"
+
+using namespace gams;
+
+class TestGAMSExceptionTimeout: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSExceptionTimeout, testConstructor_string) {
+    std::string what = "testConstructor_string()";
+    try {
+        throw GAMSExceptionTimeout(what, 130);
+    } catch(GAMSExceptionTimeout & e) {
+        EXPECT_EQ( e.rc(), 130 );
+        EXPECT_STREQ( e.what(), what.c_str());
+    }
+}
+
+TEST_F(TestGAMSExceptionTimeout, testConstructor_charptr) {
+    try {
+        throw GAMSExceptionTimeout("testConstructor_charptr()", 137);
+    } catch(GAMSExceptionTimeout & e) {
+        EXPECT_EQ( e.rc(), 137 );
+        EXPECT_STREQ( e.what(), "testConstructor_charptr()");
+    }
+}
+
+TEST_F(TestGAMSExceptionTimeout, testCaughtAsExecutionException) {
+    try {
+        throw GAMSExceptionTimeout("testCaughtAsExecutionException()", 130);
+    } catch(GAMSExceptionExecution & e) {
+        EXPECT_EQ( e.rc(), 130 );
+    }
+
+    try{
+       try {
+            throw GAMSExceptionExecution("testCaughtAsExecutionException()", 3);
+       } catch(GAMSExceptionTimeout & ) {
+           FAIL() << "do not expect GAMSExceptionTimeout to be thrown";
+       }
+    } catch(GAMSExceptionExecution & e) {
+        EXPECT_EQ( e.rc(), 3 );
+    }
+}
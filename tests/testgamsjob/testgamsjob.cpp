@@ -26,10 +26,16 @@
 #include "testgamsobject.h"
 #include "gamsworkspace.h"
 #include "gamsexceptionexecution.h"
+#include "gamsexceptiontimeout.h"
+#include "gamsoptions.h"
+#include "gamscheckpoint.h"
 #include "gamsset.h"
 #include "gamsparameter.h"
 #include "gamsvariable.h"
 #include "gamsworkspaceinfo.h"
+#include <sstream>
+#include <chrono>
+#include <thread>
 
 using namespace gams;
 
@@ -176,3 +182,172 @@ TEST_F(TestGAMSJob, testGetLogID) {
     ASSERT_TRUE( job1.logID() == job2.logID() );
     ASSERT_TRUE( job2.logID() == job3.logID() );
 }
+
+TEST_F(TestGAMSJob, testRunWithOutputStream) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("display 'hello stream';");
+    std::ostringstream log;
+    // when
+    job.run(log);
+    // then
+    EXPECT_NE( log.str().find("Status: Normal completion"), std::string::npos );
+}
+
+TEST_F(TestGAMSJob, testRunWithLogLineHandler) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    std::vector<std::string> lines;
+    // when
+    job.run(opt, [&lines](const std::string &line) { lines.push_back(line); });
+    // then
+    ASSERT_FALSE( lines.empty() );
+    for (const std::string &line : lines)
+        EXPECT_EQ( line.find('\n'), std::string::npos );
+    EXPECT_NE( lines.back().find("Status: Normal completion"), std::string::npos );
+    ASSERT_TRUE( equals(job.outDB().getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJob, testRunWithSlowLogLineHandler) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromString("scalar i; for(i = 1 to 2000, put_utility 'log' / 'line ' i:0:0;);");
+    int lineCount = 0;
+    // when
+    job.run(opt, [&lineCount](const std::string &) {
+        if (++lineCount % 100 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }, 1);
+    // then
+    EXPECT_GT( lineCount, 2000 );
+    EXPECT_EQ( job.lastRunStats().exitCode, 0 );
+}
+
+TEST_F(TestGAMSJob, testRunWithThrowingLogLineHandler) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; display i; ) until i < 0;");
+    auto start = std::chrono::steady_clock::now();
+    // when, then
+    EXPECT_THROW( job.run(opt, [](const std::string &) { throw std::runtime_error("stop"); }), std::runtime_error );
+    EXPECT_LT( std::chrono::steady_clock::now() - start, std::chrono::seconds(5) );
+}
+
+TEST_F(TestGAMSJob, testRunExecutionErrorReturnCode) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar x; x = 1/0;");
+    // when, then
+    try {
+        job.run();
+        FAIL() << "GAMSExceptionExecution expected";
+    } catch (GAMSExceptionExecution &e) {
+        EXPECT_EQ( e.rc(), GAMSEnum::ExecutionError );
+    }
+}
+
+TEST_F(TestGAMSJob, testInterruptNotRunning) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar x;");
+    // when, then
+    EXPECT_FALSE( job.interrupt() );
+    job.run();
+    EXPECT_FALSE( job.interrupt() );
+}
+
+TEST_F(TestGAMSJob, testRunWithTimeLimit) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    auto start = std::chrono::steady_clock::now();
+    // when, then
+    EXPECT_THROW( job.run(opt, std::chrono::milliseconds(500)), GAMSExceptionTimeout );
+    EXPECT_LT( std::chrono::steady_clock::now() - start, std::chrono::seconds(5) );
+}
+
+TEST_F(TestGAMSJob, testRunWithTimeLimitNotReached) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    // when
+    job.run(opt, std::chrono::minutes(5));
+    // then
+    ASSERT_TRUE( equals(job.outDB().getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJob, testLastRunStats) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    // when, then
+    ASSERT_EQ( job.lastRunStats().exitCode, -1 );
+    // when
+    job.run();
+    GAMSJobStats stats = job.lastRunStats();
+    // then
+    EXPECT_EQ( stats.exitCode, 0 );
+    EXPECT_GT( stats.executionTime, std::chrono::nanoseconds::zero() );
+    EXPECT_EQ( stats.scratchFiles, 1 );
+    EXPECT_FALSE( stats.optionFileCacheHit );
+    EXPECT_GT( stats.optionFileBytes, 0u );
+    EXPECT_GT( stats.outDBBytes, 0u );
+    EXPECT_EQ( stats.time(GAMSJobStats::Total), stats.prepareTime + stats.compileTime + stats.queueTime +
+               stats.spawnTime + stats.executionTime + stats.outDBLoadTime );
+}
+
+TEST_F(TestGAMSJob, testLastRunStatsOnError) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("Scalar x; x = 1/0;");
+    // when
+    EXPECT_THROW( job.run(), GAMSExceptionExecution );
+    // then
+    EXPECT_EQ( job.lastRunStats().exitCode, GAMSEnum::ExecutionError );
+}
+
+TEST_F(TestGAMSJob, testOutDBLoadedOnFirstAccess) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    // when
+    job.run();
+    // then
+    EXPECT_EQ( job.lastRunStats().outDBLoadTime, std::chrono::nanoseconds::zero() );
+    GAMSDatabase db = job.outDB();
+    ASSERT_TRUE( db.isValid() );
+    EXPECT_GT( job.lastRunStats().outDBLoadTime, std::chrono::nanoseconds::zero() );
+    // the database is loaded only once
+    ASSERT_TRUE( job.outDB() == db );
+    ASSERT_TRUE( equals(db.getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJob, testOutDBWithoutCreateOutDB) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    std::stringstream log;
+    // when
+    job.run(opt, GAMSCheckpoint(), log, false, {});
+    // then
+    ASSERT_FALSE( job.outDB().isValid() );
+}
@@ -0,0 +1,196 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsworkspace.h"
+#include "gamsjobhandle.h"
+#include "gamsexceptionexecution.h"
+#include "gamsexceptiontimeout.h"
+#include "gamsoptions.h"
+#include "gamscheckpoint.h"
+#include "gamsvariable.h"
+#include "gamsparameter.h"
+#include "gamsworkspaceinfo.h"
+#include <sstream>
+#include <chrono>
+
+using namespace gams;
+
+class TestGAMSJobHandle: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSJobHandle, testDefaultConstructor) {
+    // when
+    GAMSJobHandle handle;
+    // then
+    ASSERT_FALSE( handle.isValid() );
+    EXPECT_THROW( handle.wait(), GAMSException );
+    EXPECT_THROW( handle.status(), GAMSException );
+}
+
+TEST_F(TestGAMSJobHandle, testRunAsync) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromGamsLib("trnsport");
+    // when
+    GAMSJobHandle handle = job.runAsync();
+    // then
+    ASSERT_TRUE( handle.isValid() );
+    ASSERT_TRUE( handle.job() == job );
+    handle.wait();
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+    ASSERT_TRUE( equals(handle.outDB().getVariable("z").firstRecord().level(), 153.675) );
+    ASSERT_TRUE( equals(job.outDB().getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJobHandle, testRunAsyncMany) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromGamsLib("trnsport").run(cp);
+    GAMSOptions opt = ws.addOptions();
+    std::vector<GAMSJobHandle> handles;
+    // when
+    for (int i = 0; i < 8; ++i)
+        handles.push_back(ws.addJobFromString("z.l = z.l;", cp).runAsync(opt));
+    // then
+    for (GAMSJobHandle &handle : handles)
+        ASSERT_TRUE( equals(handle.outDB().getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJobHandle, testRunAsyncWithOutput) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSCheckpoint cp;
+    std::stringstream log;
+    // when
+    GAMSJobHandle handle = ws.addJobFromGamsLib("trnsport").runAsync(opt, cp, &log);
+    handle.wait();
+    // then
+    ASSERT_NE( log.str().find("Normal completion"), std::string::npos );
+}
+
+TEST_F(TestGAMSJobHandle, testWaitFor) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    // when
+    GAMSJobHandle handle = job.runAsync();
+    // then
+    ASSERT_FALSE( handle.waitFor(std::chrono::milliseconds(100)) );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobRunning );
+    ASSERT_TRUE( handle.cancel() );
+    EXPECT_THROW( handle.wait(), GAMSExceptionExecution );
+}
+
+TEST_F(TestGAMSJobHandle, testCancel) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    GAMSJobHandle handle = job.runAsync();
+    // when
+    ASSERT_TRUE( handle.cancel() );
+    // then
+    EXPECT_THROW( handle.wait(), GAMSExceptionExecution );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobCancelled );
+    ASSERT_FALSE( handle.cancel() );
+}
+
+TEST_F(TestGAMSJobHandle, testRunAsyncTwice) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    GAMSJobHandle handle = job.runAsync();
+    // when, then
+    EXPECT_THROW( job.runAsync(), GAMSException );
+    EXPECT_THROW( job.run(), GAMSException );
+
+    // when the result has been evaluated
+    handle.cancel();
+    EXPECT_THROW( handle.wait(), GAMSExceptionExecution );
+    // then, the job can run again
+    GAMSJobHandle again = job.runAsync();
+    ASSERT_TRUE( again.cancel() );
+    EXPECT_THROW( again.wait(), GAMSExceptionExecution );
+}
+
+TEST_F(TestGAMSJobHandle, testTimeLimit) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSCheckpoint cp;
+    GAMSJob job = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    // when
+    GAMSJobHandle handle = job.runAsync(opt, cp, nullptr, true, {}, std::chrono::milliseconds(500));
+    // then
+    EXPECT_THROW( handle.wait(), GAMSExceptionTimeout );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobTimedOut );
+}
+
+TEST_F(TestGAMSJobHandle, testDatabaseDroppedWhileRunning) {
+    // given, the input database is read at execution time after a pause
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSOptions opt = ws.addOptions();
+    GAMSCheckpoint cp;
+    GAMSJob job = ws.addJobFromString("Parameter p(*); Scalar s; s = sleep(1);\n"
+                                      "execute_load '%indb%', p;\n"
+                                      "abort$(card(p) <> 3) 'input records missing';");
+    GAMSJobHandle handle;
+    {
+        GAMSDatabase db = ws.addDatabase("", "indb");
+        GAMSParameter p = db.addParameter("p", 1, "input");
+        for (const std::string &key : { "a", "b", "c" })
+            p.addRecord(key).setValue(1.0);
+        // when, the caller drops the database while the job is running
+        handle = job.runAsync(opt, cp, nullptr, true, { db });
+    }
+    // then, the exported file is kept until GAMS has read it
+    EXPECT_NO_THROW( handle.wait() );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+}
+
+TEST_F(TestGAMSJobHandle, testFailed) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJob job = ws.addJobFromString("scalar x; x = 1/0;");
+    // when
+    GAMSJobHandle handle = job.runAsync();
+    // then
+    EXPECT_THROW( handle.wait(), GAMSExceptionExecution );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFailed );
+    // the error is kept for later calls
+    EXPECT_THROW( handle.wait(), GAMSExceptionExecution );
+}
@@ -0,0 +1,153 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsworkspace.h"
+#include "gamsjobscheduler.h"
+#include "gamsexceptionexecution.h"
+#include "gamsoptions.h"
+#include "gamsvariable.h"
+#include "gamsworkspaceinfo.h"
+#include <chrono>
+
+using namespace gams;
+
+class TestGAMSJobScheduler: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSJobScheduler, testConstructor) {
+    // when
+    GAMSJobScheduler scheduler(3);
+    // then
+    ASSERT_EQ( scheduler.maxJobs(), 3 );
+    ASSERT_EQ( scheduler.queueDepth(), 0 );
+    ASSERT_EQ( scheduler.runningJobs(), 0 );
+    ASSERT_EQ( scheduler.finishedJobs(), 0 );
+    ASSERT_EQ( scheduler.averageWaitTime(), std::chrono::milliseconds::zero() );
+}
+
+TEST_F(TestGAMSJobScheduler, testDefaultMaxJobs) {
+    // when
+    GAMSJobScheduler scheduler;
+    // then
+    ASSERT_GT( scheduler.maxJobs(), 0 );
+}
+
+TEST_F(TestGAMSJobScheduler, testResourceLimit) {
+    // given
+    GAMSJobScheduler scheduler;
+    // when
+    scheduler.setResourceLimit("memory", 16);
+    // then
+    ASSERT_EQ( scheduler.resourceLimit("memory"), 16 );
+    ASSERT_EQ( scheduler.resourceLimit("licenses"), 0 );
+    // when
+    scheduler.setResourceLimit("memory", 0);
+    // then
+    ASSERT_EQ( scheduler.resourceLimit("memory"), 0 );
+}
+
+TEST_F(TestGAMSJobScheduler, testSubmit) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJobScheduler scheduler(2);
+    std::vector<GAMSJobHandle> handles;
+    // when
+    for (int i = 0; i < 6; ++i) {
+        GAMSJob job = ws.addJobFromGamsLib("trnsport");
+        handles.push_back(scheduler.submit(job));
+    }
+    // then
+    ASSERT_LE( scheduler.runningJobs(), 2 );
+    scheduler.waitForAll();
+    ASSERT_EQ( scheduler.queueDepth(), 0 );
+    ASSERT_EQ( scheduler.runningJobs(), 0 );
+    ASSERT_EQ( scheduler.finishedJobs(), 6 );
+    for (GAMSJobHandle &handle : handles)
+        ASSERT_TRUE( equals(handle.outDB().getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSJobScheduler, testPriority) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJobScheduler scheduler(1);
+    GAMSJob blocker = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    GAMSJobHandle blockerHandle = scheduler.submit(blocker);
+    GAMSJob low = ws.addJobFromGamsLib("trnsport");
+    GAMSJob high = ws.addJobFromGamsLib("trnsport");
+    // when
+    GAMSJobHandle lowHandle = scheduler.submit(low, 0);
+    GAMSJobHandle highHandle = scheduler.submit(high, 10);
+    // then
+    ASSERT_EQ( scheduler.queueDepth(), 2 );
+    ASSERT_EQ( lowHandle.status(), GAMSEnum::JobQueued );
+    blockerHandle.cancel();
+    highHandle.wait();
+    ASSERT_TRUE( lowHandle.status() == GAMSEnum::JobQueued || lowHandle.status() == GAMSEnum::JobRunning );
+    lowHandle.wait();
+    ASSERT_LE( scheduler.maxWaitTime(10), scheduler.maxWaitTime(0) );
+}
+
+TEST_F(TestGAMSJobScheduler, testResourceWeights) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJobScheduler scheduler(4);
+    scheduler.setResourceLimit("licenses", 1);
+    GAMSJob job1 = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    GAMSJob job2 = ws.addJobFromGamsLib("trnsport");
+    // when
+    GAMSJobHandle handle1 = scheduler.submit(job1, 0, {{"licenses", 1}});
+    GAMSJobHandle handle2 = scheduler.submit(job2, 0, {{"licenses", 1}});
+    // then
+    ASSERT_EQ( scheduler.runningJobs(), 1 );
+    ASSERT_EQ( handle2.status(), GAMSEnum::JobQueued );
+    handle1.cancel();
+    handle2.wait();
+    ASSERT_EQ( handle2.status(), GAMSEnum::JobFinished );
+}
+
+TEST_F(TestGAMSJobScheduler, testCancelQueued) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSJobScheduler scheduler(1);
+    GAMSJob job1 = ws.addJobFromString("scalar i /0/; repeat( i = i + 1; ) until i < 0;");
+    GAMSJob job2 = ws.addJobFromGamsLib("trnsport");
+    GAMSJobHandle handle1 = scheduler.submit(job1);
+    GAMSJobHandle handle2 = scheduler.submit(job2);
+    // when
+    ASSERT_TRUE( handle2.cancel() );
+    // then
+    ASSERT_EQ( handle2.status(), GAMSEnum::JobCancelled );
+    ASSERT_EQ( scheduler.queueDepth(), 0 );
+    EXPECT_THROW( handle2.wait(), GAMSExceptionExecution );
+    handle1.cancel();
+    scheduler.waitForAll();
+    ASSERT_EQ( scheduler.runningJobs(), 0 );
+}
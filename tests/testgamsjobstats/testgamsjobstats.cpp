@@ -0,0 +1,65 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsjobstats.h"
+
+using namespace gams;
+
+class TestGAMSJobStats: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSJobStats, testDefaultConstructor) {
+    // when
+    GAMSJobStats stats;
+    // then
+    for (int phase = 0; phase < GAMSJobStats::cPhaseCount; ++phase)
+        EXPECT_EQ( stats.time(GAMSJobStats::Phase(phase)), std::chrono::nanoseconds::zero() );
+    EXPECT_EQ( stats.inputBytes, 0u );
+    EXPECT_EQ( stats.logBytes, 0u );
+    EXPECT_EQ( stats.exitCode, -1 );
+    EXPECT_FALSE( stats.compileCacheHit );
+}
+
+TEST_F(TestGAMSJobStats, testTotalTime) {
+    // given
+    GAMSJobStats stats;
+    stats.prepareTime = std::chrono::nanoseconds(1);
+    stats.compileTime = std::chrono::nanoseconds(2);
+    stats.queueTime = std::chrono::nanoseconds(4);
+    stats.spawnTime = std::chrono::nanoseconds(8);
+    stats.executionTime = std::chrono::nanoseconds(16);
+    stats.outDBLoadTime = std::chrono::nanoseconds(32);
+    // when, then
+    EXPECT_EQ( stats.time(GAMSJobStats::Execution), std::chrono::nanoseconds(16) );
+    EXPECT_EQ( stats.time(GAMSJobStats::Total), std::chrono::nanoseconds(63) );
+}
+
+TEST_F(TestGAMSJobStats, testText) {
+    EXPECT_EQ( GAMSJobStats::text(GAMSJobStats::Prepare), "Prepare" );
+    EXPECT_EQ( GAMSJobStats::text(GAMSJobStats::OutDBLoad), "OutDBLoad" );
+    EXPECT_EQ( GAMSJobStats::text(GAMSJobStats::Total), "Total" );
+}
@@ -24,6 +24,9 @@
  */
 #include <fstream>
 #include <sstream>
+#include <filesystem>
+#include <chrono>
+#include <numeric>
 
 #include "testgamsobject.h"
 #include "gamscheckpoint.h"
@@ -31,6 +34,7 @@
 #include "gamsoptions.h"
 #include "gamsparameter.h"
 #include "gamsvariable.h"
+#include "gamsequation.h"
 
 using namespace gams;
 using namespace std;
@@ -187,6 +191,499 @@ TEST_F(TestGAMSModelInstance, testCopyModelInstance) {
     EXPECT_EQ( newmi.syncDb().getParameter("bmult").numberRecords(), mi.syncDb().getParameter("bmult").numberRecords() );
 }
 
+TEST_F(TestGAMSModelInstance, testInstantiationCache) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    ws.setInstantiationCache(true);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+    auto countCachedDirs = [&ws]() {
+        int count = 0;
+        for (const auto &entry : std::filesystem::directory_iterator(ws.workingDirectory())) {
+            if (entry.path().filename().string().rfind(ws.scratchFilePrefix() + "ic_", 0) == 0)
+                count++;
+        }
+        return count;
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        GAMSModelInstance mi = cp.addModelInstance();
+        GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+        // when
+        mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+        bmult.addRecord().setValue(1.0);
+        mi.solve();
+        // then
+        ASSERT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+    }
+    EXPECT_TRUE( ws.instantiationCache() );
+    EXPECT_EQ( countCachedDirs(), 1 );
+
+    // when
+    GAMSModelInstance mi = cp.addModelInstance();
+    mi.instantiate("transport use lp max z");
+    // then
+    EXPECT_EQ( countCachedDirs(), 2 );
+}
+
+TEST_F(TestGAMSModelInstance, testSolveSkipsUnchangedModifiers) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    GAMSParameter xup = mi.syncDb().addParameter("xup", 2, "upper bound on x");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult),
+                   GAMSModifier(mi.syncDb().getVariable("x"), GAMSEnum::SymbolUpdateAction::Upper, xup));
+    bmult.addRecord().setValue(1.0);
+    xup.addRecord("seattle", "new-york").setValue(1000.0);
+
+    // when
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 2 );
+    EXPECT_EQ( mi.lastSolveSkippedModifiers(), 0 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 0 );
+    EXPECT_EQ( mi.lastSolveSkippedModifiers(), 2 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when
+    bmult.firstRecord().setValue(0.9);
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 1 );
+    EXPECT_EQ( mi.lastSolveSkippedModifiers(), 1 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 138.3075) );
+
+    // when
+    mi.solve(GAMSEnum::SymbolUpdateType::Accumulate);
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 2 );
+    EXPECT_EQ( mi.lastSolveSkippedModifiers(), 0 );
+}
+
+TEST_F(TestGAMSModelInstance, testSolvePushesModifiedRecords) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter xup = mi.syncDb().addParameter("xup", 2, "upper bound on x");
+    mi.instantiate("transport use lp min z",
+                   GAMSModifier(mi.syncDb().getVariable("x"), GAMSEnum::SymbolUpdateAction::Upper, xup));
+    for (const string &i : { "seattle", "san-diego" })
+        for (const string &j : { "new-york", "chicago", "topeka" })
+            xup.addRecord(i, j).setValue(1000.0);
+
+    // when
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 6 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+    int nrSymbols = mi.syncDb().getNrSymbols();
+
+    // when
+    xup.findRecord("seattle", "new-york").setValue(0.0);
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 1 );
+    EXPECT_EQ( mi.lastSolveSkippedModifiers(), 0 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("x").findRecord("seattle", "new-york").level(), 0.0) );
+    // the modified records are pushed without adding symbols to SyncDB
+    EXPECT_EQ( mi.syncDb().getNrSymbols(), nrSymbols );
+
+    // when
+    xup.deleteRecord({ "seattle", "new-york" });
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 5 );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSModelInstance, testSolutionSnapshots) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    GAMSModelInstanceOpt opt;
+    opt.setResultSnapshot("base");
+
+    // when
+    mi.solve(opt);
+    // then
+    ASSERT_TRUE( mi.hasSnapshot("base") );
+    int coldIterations = mi.lastSolveIterations();
+    EXPECT_GT( coldIterations, 0 );
+
+    // when, warm-start from the solution of the same scenario
+    GAMSModelInstanceOpt warmOpt;
+    warmOpt.setStartSnapshot("base");
+    mi.solve(warmOpt);
+    // then
+    EXPECT_LE( mi.lastSolveIterations(), coldIterations );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when
+    bmult.firstRecord().setValue(0.9);
+    mi.solve(warmOpt);
+    // then
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 138.3075) );
+
+    // when
+    mi.swapSnapshot("base");
+    mi.saveSnapshot("scaled");
+    mi.swapSnapshot("base");
+    // then
+    ASSERT_TRUE( mi.hasSnapshot("scaled") );
+    EXPECT_THROW( mi.restoreSnapshot("unknown"), GAMSException );
+    mi.removeSnapshot("scaled");
+    ASSERT_TRUE( ! mi.hasSnapshot("scaled") );
+
+    // when
+    GAMSModelInstance newmi = mi.copyModelInstance();
+    // then
+    ASSERT_TRUE( newmi.hasSnapshot("base") );
+}
+
+TEST_F(TestGAMSModelInstance, testSolveBatch) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+
+    GAMSBatchScenarios scenarios;
+    scenarios.addColumn(bmult, {}, {0.6, 0.7, 0.8, 0.9, 1.0});
+    GAMSBatchResults results;
+    results.addLevel(mi.syncDb().getVariable("z"));
+    results.addMarginal(mi.syncDb().getEquation("demand"), {"new-york"});
+
+    // when
+    mi.solveBatch(scenarios, results);
+
+    // then
+    std::vector<double> expected = {92.205, 107.5725, 122.94, 138.3075, 153.675};
+    ASSERT_EQ( results.objective.size(), expected.size() );
+    ASSERT_EQ( results.columns.size(), 2u );
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_EQ( results.modelStatus[i], GAMSEnum::ModelStat::OptimalGlobal );
+        EXPECT_EQ( results.solveStatus[i], GAMSEnum::SolveStat::Normal );
+        EXPECT_TRUE( equals(results.objective[i], expected[i]) );
+        EXPECT_TRUE( equals(results.columns[0].values[i], expected[i]) );
+        EXPECT_GT( results.columns[1].values[i], 0.0 );
+    }
+
+    // when, the buffers are reused for a smaller batch
+    const double *buffer = results.objective.data();
+    GAMSBatchScenarios single;
+    single.addColumn(bmult, {}, {1.0});
+    mi.solveBatch(single, results);
+    // then
+    ASSERT_EQ( results.objective.size(), 1u );
+    EXPECT_EQ( results.objective.data(), buffer );
+    EXPECT_TRUE( equals(results.objective[0], 153.675) );
+
+    EXPECT_THROW( scenarios.addColumn(bmult, {}, {1.0}), GAMSException );
+    EXPECT_THROW( results.addLevel(bmult), GAMSException );
+}
+
+TEST_F(TestGAMSModelInstance, testSolveBatchPushesScenarioRecords) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter xup = mi.syncDb().addParameter("xup", 2, "upper bound on x");
+    mi.instantiate("transport use lp min z",
+                   GAMSModifier(mi.syncDb().getVariable("x"), GAMSEnum::SymbolUpdateAction::Upper, xup));
+    for (const string &i : { "seattle", "san-diego" })
+        for (const string &j : { "new-york", "chicago", "topeka" })
+            xup.addRecord(i, j).setValue(1000.0);
+
+    GAMSBatchScenarios scenarios;
+    scenarios.addColumn(xup, {"seattle", "new-york"}, {0.0, 1000.0});
+    GAMSBatchResults results;
+    results.addLevel(mi.syncDb().getVariable("x"), {"seattle", "new-york"});
+
+    // when
+    mi.solveBatch(scenarios, results);
+
+    // then
+    ASSERT_EQ( results.objective.size(), 2u );
+    EXPECT_TRUE( equals(results.columns[0].values[0], 0.0) );
+    EXPECT_TRUE( equals(results.objective[1], 153.675) );
+    EXPECT_EQ( mi.lastSolveUpdatedRecords(), 1 );
+}
+
+TEST_F(TestGAMSModelInstance, testSolveWithSolverLogHandler) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+
+    // when
+    std::vector<std::string> lines;
+    GAMSSolverProgress last;
+    mi.solve(GAMSEnum::SymbolUpdateType::BaseCase, [&](const std::string& line, const GAMSSolverProgress& progress) {
+        lines.push_back(line);
+        last = progress;
+    });
+    // then
+    ASSERT_FALSE( lines.empty() );
+    EXPECT_EQ( last.lines, static_cast<int>(lines.size()) );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when, the handler is called for the first and the last line only
+    int calls = 0;
+    mi.solve(GAMSEnum::SymbolUpdateType::BaseCase, [&](const std::string&, const GAMSSolverProgress& progress) {
+        calls++;
+        last = progress;
+    }, GAMSModelInstanceOpt(), std::chrono::hours(1));
+    // then
+    EXPECT_LE( calls, 2 );
+    EXPECT_GT( last.lines, 0 );
+
+    // when
+    auto throwing = [](const std::string&, const GAMSSolverProgress&) { throw std::runtime_error("stop"); };
+    // then
+    EXPECT_THROW( mi.solve(GAMSEnum::SymbolUpdateType::BaseCase, throwing), std::runtime_error );
+}
+
+TEST_F(TestGAMSModelInstance, testSolveAfterUnknownSolver) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    auto ignore = [](const std::string&, const GAMSSolverProgress&) {};
+
+    // when, then
+    EXPECT_THROW( mi.solve(GAMSEnum::SymbolUpdateType::BaseCase, ignore, GAMSModelInstanceOpt("nosuchsolver")),
+                  GAMSException );
+
+    // when, the log of the failed solve is no longer sent to its handler
+    std::vector<std::string> lines;
+    mi.solve(GAMSEnum::SymbolUpdateType::BaseCase, [&lines](const std::string& line, const GAMSSolverProgress&) {
+        lines.push_back(line);
+    });
+    // then
+    EXPECT_FALSE( lines.empty() );
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when
+    mi.solve();
+    // then
+    EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSModelInstance, testModelInstanceDirectory) {
+    // given
+    std::filesystem::path miDir = std::filesystem::temp_directory_path() / "testModelInstanceDirectory";
+    std::filesystem::create_directories(miDir);
+    testCleanupDirs.insert(miDir.string());
+    auto countEntries = [](const std::filesystem::path &dir) {
+        return std::distance(std::filesystem::recursive_directory_iterator(dir),
+                             std::filesystem::recursive_directory_iterator());
+    };
+    {
+        GAMSWorkspaceInfo wsInfo("", testSystemDir);
+        GAMSWorkspace ws(wsInfo);
+        testCleanupDirs.insert(ws.workingDirectory());
+        GAMSCheckpoint cp = ws.addCheckpoint();
+        ws.addJobFromString(getModelText()).run(cp);
+
+        // when
+        ws.setModelInstanceDirectory(miDir.string());
+        GAMSModelInstance mi = cp.addModelInstance();
+        mi.instantiate("transport use lp min z");
+        mi.solve();
+        // then
+        EXPECT_TRUE( equals( mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+        auto entries = countEntries(miDir);
+        EXPECT_GT( entries, 1 );
+
+        // when
+        for (int i = 0; i < 10; ++i)
+            mi.copyModelInstance();
+        // then, the copies are removed again
+        EXPECT_EQ( countEntries(miDir), entries );
+    }
+    // then
+    EXPECT_EQ( countEntries(miDir), 0 );
+}
+
+TEST_F(TestGAMSModelInstance, testInstantiationCacheInModelInstanceDirectory) {
+    // given
+    std::filesystem::path miDir = std::filesystem::temp_directory_path() / "testInstantiationCacheDirectory";
+    std::filesystem::create_directories(miDir);
+    testCleanupDirs.insert(miDir.string());
+    auto countCachedDirs = [](const std::filesystem::path &dir, const std::string &prefix) {
+        int count = 0;
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(dir)) {
+            if (entry.path().filename().string().rfind(prefix + "ic_", 0) == 0)
+                count++;
+        }
+        return count;
+    };
+    {
+        GAMSWorkspaceInfo wsInfo("", testSystemDir);
+        GAMSWorkspace ws(wsInfo);
+        testCleanupDirs.insert(ws.workingDirectory());
+        ws.setInstantiationCache(true);
+        ws.setModelInstanceDirectory(miDir.string());
+        GAMSCheckpoint cp = ws.addCheckpoint();
+        ws.addJobFromString(getModelText()).run(cp);
+
+        // when
+        GAMSModelInstance mi = cp.addModelInstance();
+        mi.instantiate("transport use lp min z");
+        // then
+        EXPECT_EQ( countCachedDirs(miDir, ws.scratchFilePrefix()), 1 );
+        EXPECT_EQ( countCachedDirs(ws.workingDirectory(), ws.scratchFilePrefix()), 0 );
+    }
+    // then
+    EXPECT_TRUE( std::filesystem::is_empty(miDir) );
+}
+
+TEST_F(TestGAMSModelInstance, testLastSolveStats) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    auto count = [&mi](GAMSModelInstanceStats::Phase phase) {
+        std::vector<int> histogram = mi.solveStatsHistogram(phase);
+        return std::accumulate(histogram.begin(), histogram.end(), 0);
+    };
+    // when, then
+    EXPECT_EQ( mi.lastSolveStats().time(GAMSModelInstanceStats::Total).count(), 0 );
+    EXPECT_EQ( count(GAMSModelInstanceStats::Total), 0 );
+
+    // when
+    mi.solve();
+    // then
+    GAMSModelInstanceStats stats = mi.lastSolveStats();
+    EXPECT_EQ( stats.updatedRecords, 1 );
+    EXPECT_EQ( stats.skippedModifiers, 0 );
+    EXPECT_EQ( stats.unmatchedRecords, 0 );
+    EXPECT_GT( stats.iterations, 0 );
+    EXPECT_GT( stats.time(GAMSModelInstanceStats::Total).count(), 0 );
+    EXPECT_EQ( stats.time(GAMSModelInstanceStats::Total),
+               stats.updateTime + stats.solverTime + stats.syncTime + stats.logTime );
+    EXPECT_EQ( GAMSModelInstanceStats::text(GAMSModelInstanceStats::Solver), "Solver" );
+
+    // when
+    mi.solve();
+    // then
+    EXPECT_EQ( mi.lastSolveStats().updatedRecords, 0 );
+    EXPECT_EQ( mi.lastSolveStats().skippedModifiers, 1 );
+    for (int phase = 0; phase < GAMSModelInstanceStats::cPhaseCount; ++phase)
+        EXPECT_EQ( count(GAMSModelInstanceStats::Phase(phase)), 2 );
+
+    // when
+    mi.resetSolveStatsHistogram();
+    // then
+    EXPECT_EQ( count(GAMSModelInstanceStats::Total), 0 );
+}
+
+TEST_F(TestGAMSModelInstance, testExtractSolution) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getModelText()).run(cp);
+
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    mi.solve();
+
+    // when
+    std::vector<std::vector<std::string>> keys = mi.solutionKeys("x");
+    std::vector<double> levels(mi.solutionRecords("x"));
+    std::vector<double> marginals(levels.size());
+    mi.extractSolution("x", levels.data(), marginals.data());
+    // then
+    ASSERT_EQ( keys.size(), 6u );
+    ASSERT_EQ( levels.size(), 6u );
+    GAMSVariable x = mi.syncDb().getVariable("x");
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ( keys[i].size(), 2u );
+        EXPECT_TRUE( equals(levels[i], x.findRecord(keys[i]).level()) );
+        EXPECT_TRUE( equals(marginals[i], x.findRecord(keys[i]).marginal()) );
+    }
+
+    // when, equations and symbol names are not case sensitive
+    std::vector<double> supplyMarginals(mi.solutionRecords("Supply"));
+    mi.extractSolution("Supply", nullptr, supplyMarginals.data());
+    // then
+    keys = mi.solutionKeys("supply");
+    ASSERT_EQ( supplyMarginals.size(), 2u );
+    GAMSEquation supply = mi.syncDb().getEquation("supply");
+    for (size_t i = 0; i < keys.size(); ++i)
+        EXPECT_TRUE( equals(supplyMarginals[i], supply.findRecord(keys[i]).marginal()) );
+
+    // when, the next solve changes the solution
+    bmult.firstRecord().setValue(0.9);
+    mi.solve();
+    double z = 0;
+    mi.extractSolution("z", &z);
+    // then
+    EXPECT_EQ( mi.solutionRecords("z"), 1 );
+    EXPECT_TRUE( equals(z, mi.syncDb().getVariable("z").findRecord().level()) );
+    EXPECT_THROW( mi.extractSolution("nosymbol", &z), GAMSException );
+}
+
 TEST_F(TestGAMSModelInstance, testGetCheckpoint) {
     // given
     GAMSWorkspaceInfo wsInfo("", testSystemDir);
@@ -78,6 +78,21 @@ TEST_F(TestGAMSModelInstanceOpt, testEqualToOperator) {
     ASSERT_TRUE( miopt == miopt2 );
 }
 
+TEST_F(TestGAMSModelInstanceOpt, testGetSetSnapshots) {
+    GAMSModelInstanceOpt miopt;
+    ASSERT_TRUE( miopt.startSnapshot().empty() );
+    ASSERT_TRUE( miopt.resultSnapshot().empty() );
+    ASSERT_TRUE( ! miopt.startSnapshotOverridesUpdate() );
+
+    miopt.setStartSnapshot("start");
+    miopt.setResultSnapshot("result");
+    miopt.setStartSnapshotOverridesUpdate(true);
+    EXPECT_EQ( miopt.startSnapshot(), "start" );
+    EXPECT_EQ( miopt.resultSnapshot(), "result" );
+    ASSERT_TRUE( miopt.startSnapshotOverridesUpdate() );
+    ASSERT_TRUE( miopt != GAMSModelInstanceOpt() );
+}
+
 class ParameterizedTestGetSetOptFile
         : public ::testing::WithParamInterface<std::tuple<std::string,int>>,
           public TestGAMSModelInstanceOpt {
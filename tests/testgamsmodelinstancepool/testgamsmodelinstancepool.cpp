@@ -0,0 +1,122 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsworkspace.h"
+#include "gamsworkspaceinfo.h"
+#include "gamscheckpoint.h"
+#include "gamsmodelinstance.h"
+#include "gamsmodelinstancepool.h"
+#include "gamsparameter.h"
+#include "gamsparameterrecord.h"
+#include "gamsvariable.h"
+#include "gamsvariablerecord.h"
+#include <stdexcept>
+
+using namespace gams;
+
+class TestGAMSModelInstancePool: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSModelInstancePool, testNotInstantiatedSource) {
+    // given
+    GAMSModelInstance mi;
+    // when, then
+    EXPECT_THROW( GAMSModelInstancePool pool(mi, 2), GAMSException );
+}
+
+TEST_F(TestGAMSModelInstancePool, testRun) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    GAMSModelInstancePool pool(mi, 3);
+    std::vector<double> bmultValues = { 1.0, 0.9, 0.8, 1.0, 0.7, 1.0, 0.6, 1.0 };
+    // when
+    std::vector<double> z = pool.run<double>(static_cast<int>(bmultValues.size()),
+        [&bmultValues](GAMSModelInstance &worker, int scenario) {
+            worker.syncDb().getParameter("bmult").firstRecord().setValue(bmultValues[scenario]);
+            worker.solve();
+            return worker.syncDb().getVariable("z").firstRecord().level();
+        });
+    // then
+    ASSERT_EQ( pool.numberOfWorkers(), 3 );
+    ASSERT_EQ( z.size(), bmultValues.size() );
+    for (size_t i = 0; i < z.size(); ++i) {
+        if (bmultValues[i] == 1.0)
+            EXPECT_TRUE( equals(z[i], 153.675) );
+        else
+            EXPECT_LT( z[i], 153.675 );
+    }
+    EXPECT_EQ( pool.scenariosSolved(), 8 );
+    EXPECT_EQ( pool.scenariosFailed(), 0 );
+    EXPECT_EQ( pool.instancesReplaced(), 0 );
+    EXPECT_GT( pool.throughput(), 0.0 );
+    EXPECT_GT( pool.utilization(), 0.0 );
+    EXPECT_LE( pool.utilization(), 1.0 );
+}
+
+TEST_F(TestGAMSModelInstancePool, testRunReplacesFailingInstance) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    GAMSModelInstance mi = cp.addModelInstance();
+    GAMSParameter bmult = mi.syncDb().addParameter("bmult", 0, "demand multiplier");
+    mi.instantiate("transport use lp min z", GAMSModifier(bmult));
+    bmult.addRecord().setValue(1.0);
+    GAMSModelInstancePool pool(mi, 2);
+    std::vector<int> attempts(4, 0);
+    // when
+    EXPECT_THROW( pool.run(4, [&attempts](GAMSModelInstance &worker, int scenario) {
+        attempts[scenario]++;
+        if (scenario == 2 && attempts[scenario] == 1)
+            throw std::runtime_error("worker failure");
+        if (scenario == 3)
+            throw std::runtime_error("permanent failure");
+        worker.solve();
+    }), std::runtime_error );
+    // then
+    EXPECT_EQ( attempts[0], 1 );
+    EXPECT_EQ( attempts[2], 2 );
+    EXPECT_EQ( attempts[3], 2 );
+    EXPECT_EQ( pool.scenariosSolved(), 3 );
+    EXPECT_EQ( pool.scenariosFailed(), 1 );
+    // the instance failing the last scenario is not replaced, no scenario is left to use it
+    EXPECT_EQ( pool.instancesReplaced(), 2 );
+
+    // when, then: the pool remains usable
+    EXPECT_NO_THROW( pool.run(2, [](GAMSModelInstance &worker, int) { worker.solve(); }) );
+    EXPECT_EQ( pool.scenariosSolved(), 5 );
+}
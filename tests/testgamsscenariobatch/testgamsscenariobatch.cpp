@@ -0,0 +1,164 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsworkspace.h"
+#include "gamsscenariobatch.h"
+#include "gamsexceptionexecution.h"
+#include "gamsoptions.h"
+#include "gamscheckpoint.h"
+#include "gamsdatabase.h"
+#include "gamsparameter.h"
+#include "gamsparameterrecord.h"
+#include "gamsvariable.h"
+#include "gamsvariablerecord.h"
+#include "gamsworkspaceinfo.h"
+#include <sstream>
+#include <filesystem>
+
+using namespace gams;
+
+class TestGAMSScenarioBatch: public TestGAMSObject
+{
+};
+
+TEST_F(TestGAMSScenarioBatch, testDefaultConstructor) {
+    // when
+    GAMSScenarioBatch batch;
+    // then
+    ASSERT_FALSE( batch.isValid() );
+    EXPECT_THROW( batch.numberOfScenarios(), GAMSException );
+    EXPECT_THROW( batch.run(), GAMSException );
+}
+
+TEST_F(TestGAMSScenarioBatch, testRunWithoutScenarios) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    // when
+    GAMSScenarioBatch batch = cp.addScenarioBatch("solve transport using lp minimizing z;");
+    // then
+    ASSERT_TRUE( batch.isValid() );
+    ASSERT_EQ( batch.numberOfScenarios(), 0 );
+    EXPECT_THROW( batch.run(), GAMSException );
+    EXPECT_THROW( batch.outDB(0), GAMSException );
+}
+
+TEST_F(TestGAMSScenarioBatch, testRun) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    GAMSScenarioBatch batch = cp.addScenarioBatch("c(i,j) = f*d(i,j)/1000;\n"
+                                                  "solve transport using lp minimizing z;");
+    std::vector<double> freight = { 90, 45, 180 };
+    for (double f: freight) {
+        GAMSDatabase db = ws.addDatabase();
+        db.addParameter("f", 0, "freight in dollars per case per thousand miles").addRecord().setValue(f);
+        batch.addScenario(db);
+    }
+    // when
+    batch.run();
+    // then
+    ASSERT_EQ( batch.numberOfScenarios(), 3 );
+    for (int i = 0; i < batch.numberOfScenarios(); ++i) {
+        GAMSDatabase out = batch.outDB(i);
+        ASSERT_TRUE( equals(out.getParameter("f").firstRecord().value(), freight[i]) );
+        ASSERT_TRUE( equals(out.getVariable("z").firstRecord().level(), 153.675 * freight[i] / 90) );
+    }
+    EXPECT_THROW( batch.outDB(3), GAMSException );
+}
+
+TEST_F(TestGAMSScenarioBatch, testRunWithQuoteInFileNames) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    ws.setScratchFilePrefix("sb'");
+    GAMSScenarioBatch batch = cp.addScenarioBatch("c(i,j) = f*d(i,j)/1000;\n"
+                                                  "solve transport using lp minimizing z;");
+    GAMSDatabase db = ws.addDatabase();
+    db.addParameter("f", 0, "freight in dollars per case per thousand miles").addRecord().setValue(90);
+    batch.addScenario(db);
+    // when
+    batch.run();
+    // then
+    ASSERT_TRUE( equals(batch.outDB(0).getVariable("z").firstRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSScenarioBatch, testRunKeepsResultsBeforeFailure) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    GAMSScenarioBatch batch = cp.addScenarioBatch("c(i,j) = f*d(i,j)/1000;\n"
+                                                  "solve transport using lp minimizing z;\n"
+                                                  "abort$(f < 0) 'negative freight';");
+    for (double f: { 90.0, -1.0, 45.0 }) {
+        GAMSDatabase db = ws.addDatabase();
+        db.addParameter("f", 0).addRecord().setValue(f);
+        batch.addScenario(db);
+    }
+    // when
+    EXPECT_THROW( batch.run(), GAMSExceptionExecution );
+    // then
+    ASSERT_TRUE( equals(batch.outDB(0).getVariable("z").firstRecord().level(), 153.675) );
+    EXPECT_THROW( batch.outDB(1), GAMSException );
+    EXPECT_THROW( batch.outDB(2), GAMSException );
+}
+
+TEST_F(TestGAMSScenarioBatch, testRunScenariosWithDifferentInputs) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    GAMSCheckpoint cp = ws.addCheckpoint();
+    ws.addJobFromString(getLongModelText()).run(cp);
+    GAMSScenarioBatch batch = cp.addScenarioBatch("c(i,j) = f*d(i,j)/1000;\n"
+                                                  "solve transport using lp minimizing z;");
+    GAMSDatabase cheap = ws.addDatabase();
+    cheap.addParameter("f", 0).addRecord().setValue(45);
+    GAMSDatabase unchanged = ws.addDatabase();
+    GAMSDatabase expensive = ws.addDatabase();
+    expensive.addParameter("f", 0).addRecord().setValue(180);
+    batch.addScenario(cheap);
+    batch.addScenario(unchanged);
+    batch.addScenario(expensive);
+    // when
+    batch.run();
+    // then
+    ASSERT_TRUE( equals(batch.outDB(0).getVariable("z").firstRecord().level(), 153.675 / 2) );
+    ASSERT_TRUE( equals(batch.outDB(1).getVariable("z").firstRecord().level(), 153.675 / 2) );
+    ASSERT_TRUE( equals(batch.outDB(2).getVariable("z").firstRecord().level(), 153.675 * 2) );
+    for (const auto &entry : std::filesystem::directory_iterator(ws.workingDirectory())) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind(ws.scratchFilePrefix() + "sb", 0) == 0)
+            EXPECT_EQ( name.find("_in"), std::string::npos );
+    }
+}
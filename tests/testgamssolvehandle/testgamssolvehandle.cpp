@@ -0,0 +1,171 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamsworkspace.h"
+#include "gamssolvehandle.h"
+#include "gamsmodelinstance.h"
+#include "gamsmodifier.h"
+#include "gamscheckpoint.h"
+#include "gamsparameter.h"
+#include "gamsvariable.h"
+#include "gamsworkspaceinfo.h"
+#include <chrono>
+#include <future>
+
+using namespace gams;
+
+class TestGAMSSolveHandle: public TestGAMSObject
+{
+public:
+    /// Instantiates trnsport with the freight cost as modifier
+    static GAMSModelInstance trnsportInstance(GAMSWorkspace &ws) {
+        GAMSCheckpoint cp = ws.addCheckpoint();
+        ws.addJobFromGamsLib("trnsport").run(cp);
+        GAMSModelInstance mi = cp.addModelInstance();
+        GAMSParameter f = mi.syncDb().addParameter("f", 0, "freight in dollars per case per thousand miles");
+        mi.instantiate("transport use lp min z", GAMSModifier(f));
+        f.addRecord().setValue(90);
+        return mi;
+    }
+};
+
+TEST_F(TestGAMSSolveHandle, testDefaultConstructor) {
+    // when
+    GAMSSolveHandle handle;
+    // then
+    ASSERT_FALSE( handle.isValid() );
+    EXPECT_THROW( handle.wait(), GAMSException );
+    EXPECT_THROW( handle.status(), GAMSException );
+    EXPECT_THROW( handle.cancel(), GAMSException );
+}
+
+TEST_F(TestGAMSSolveHandle, testSolveAsync) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSModelInstance mi = trnsportInstance(ws);
+    // when
+    GAMSSolveHandle handle = mi.solveAsync();
+    // then
+    ASSERT_TRUE( handle.isValid() );
+    handle.wait();
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+    ASSERT_EQ( handle.winner(), 0 );
+    ASSERT_TRUE( handle.accepted() );
+    ASSERT_EQ( handle.modelStatus(), GAMSEnum::ModelStat::OptimalGlobal );
+    ASSERT_EQ( handle.solveStatus(), GAMSEnum::SolveStat::Normal );
+    ASSERT_TRUE( equals(mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+    ASSERT_FALSE( handle.cancel() );
+}
+
+TEST_F(TestGAMSSolveHandle, testTimeLimit) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSModelInstance mi = trnsportInstance(ws);
+    // when
+    GAMSSolveHandle handle = mi.solveAsync(GAMSModelInstanceOpt(), std::chrono::hours(1));
+    // then
+    ASSERT_TRUE( handle.waitFor(std::chrono::minutes(1)) );
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+    ASSERT_TRUE( equals(handle.modelInstance().syncDb().getVariable("z").findRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSSolveHandle, testCancel) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSModelInstance mi = trnsportInstance(ws);
+    GAMSSolveHandle handle = mi.solveAsync();
+    // when, the solve may already be finished
+    bool cancelled = handle.cancel();
+    // then
+    EXPECT_NO_THROW( handle.wait() );
+    ASSERT_EQ( handle.status(), cancelled ? GAMSEnum::JobCancelled : GAMSEnum::JobFinished );
+    ASSERT_FALSE( handle.cancel() );
+    // the model instance can be solved again
+    mi.solve();
+    ASSERT_TRUE( equals(mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSSolveHandle, testSolveWhileSolving) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSModelInstance mi = trnsportInstance(ws);
+    // the acceptance check keeps the solve running until it is released
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    GAMSSolveHandle handle = mi.solvePortfolio({ GAMSModelInstanceOpt() }, std::chrono::milliseconds::zero(),
+                                               [released](GAMSModelInstance &) { released.wait(); return true; });
+    // when, then
+    EXPECT_THROW( mi.solveAsync(), GAMSException );
+    EXPECT_THROW( mi.solve(), GAMSException );
+    EXPECT_THROW( mi.solvePortfolio({ GAMSModelInstanceOpt() }), GAMSException );
+    release.set_value();
+    handle.wait();
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+
+    // when, the model instance can be solved again
+    mi.solveAsync().wait();
+    mi.solve();
+    // then
+    ASSERT_TRUE( equals(mi.syncDb().getVariable("z").findRecord().level(), 153.675) );
+}
+
+TEST_F(TestGAMSSolveHandle, testSolvePortfolio) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    testCleanupDirs.insert(ws.workingDirectory());
+    GAMSModelInstance mi = trnsportInstance(ws);
+    std::vector<GAMSModelInstanceOpt> alternatives { GAMSModelInstanceOpt(), GAMSModelInstanceOpt("conopt") };
+    // when
+    GAMSSolveHandle handle = mi.solvePortfolio(alternatives);
+    // then
+    handle.wait();
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFinished );
+    ASSERT_TRUE( handle.accepted() );
+    ASSERT_TRUE( handle.winner() == 0 || handle.winner() == 1 );
+    ASSERT_TRUE( equals(handle.modelInstance().syncDb().getVariable("z").findRecord().level(), 153.675) );
+
+    // when, no result is acceptable
+    handle = mi.solvePortfolio(alternatives, std::chrono::milliseconds::zero(),
+                               [](GAMSModelInstance &) { return false; });
+    handle.wait();
+    // then, the first result is still available
+    ASSERT_EQ( handle.status(), GAMSEnum::JobFailed );
+    ASSERT_FALSE( handle.accepted() );
+    ASSERT_GE( handle.winner(), 0 );
+    ASSERT_EQ( handle.modelStatus(), GAMSEnum::ModelStat::OptimalGlobal );
+
+    // when, then
+    EXPECT_THROW( mi.solvePortfolio({}), GAMSException );
+}
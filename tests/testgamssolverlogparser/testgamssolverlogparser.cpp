@@ -0,0 +1,117 @@
+/**
+ * GAMS C++ API
+ *
+ * Copyright (c) 2017-2025 GAMS Software GmbH <support@gams.com>
+ * Copyright (c) 2017-2025 GAMS Development Corp. <support@gams.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "testgamsobject.h"
+#include "gamssolverlogparser.h"
+
+using namespace gams;
+
+class TestGAMSSolverLogParser: public TestGAMSObject
+{
+public:
+    GAMSSolverProgress parse(const std::vector<std::string> &lines) {
+        GAMSSolverLogParser parser;
+        GAMSSolverProgress progress;
+        for (const std::string &line : lines)
+            parser.parse(line, progress);
+        return progress;
+    }
+};
+
+TEST_F(TestGAMSSolverLogParser, testWithoutNodeLog) {
+    // when
+    GAMSSolverProgress progress = parse({ "Iteration      Dual Objective            In Variable           Out Variable",
+                                          "     1              73.125000    x(seattle,new-york) demand(new-york) slack",
+                                          "LP status(1): optimal" });
+    // then
+    EXPECT_TRUE( std::isnan(progress.incumbent) );
+    EXPECT_TRUE( std::isnan(progress.bestBound) );
+}
+
+TEST_F(TestGAMSSolverLogParser, testCplexNodeLog) {
+    // given
+    std::vector<std::string> lines = {
+        "        Nodes                                         Cuts/",
+        "   Node  Left     Objective  IInf  Best Integer    Best Bound    ItCnt     Gap",
+        "",
+        "      0     0        2.0000    12                      2.0000       25         "
+    };
+    // when
+    GAMSSolverProgress progress = parse(lines);
+    // then, no gap is reported without an incumbent
+    EXPECT_TRUE( std::isnan(progress.incumbent) );
+
+    // when, a heuristic solution has no iteration count
+    lines.push_back("*     0+    0                           26.0000        2.0000           92.31%");
+    progress = parse(lines);
+    // then
+    EXPECT_TRUE( equals(progress.incumbent, 26.0) );
+    EXPECT_TRUE( equals(progress.bestBound, 2.0) );
+
+    // when
+    lines.push_back("      0     2        2.0000    12       26.0000        2.0000       25   92.31%");
+    lines.push_back("Elapsed time = 0.02 sec. (3.12 ticks, tree = 0.01 MB, solutions = 2)");
+    lines.push_back("*    20    10      integral     0        6.0000        3.0000      109   50.00%");
+    progress = parse(lines);
+    // then
+    EXPECT_TRUE( equals(progress.incumbent, 6.0) );
+    EXPECT_TRUE( equals(progress.bestBound, 3.0) );
+
+    // when, cut rounds report the cuts instead of the bound
+    lines.push_back("      0     0        3.0000    12        6.0000      Cuts: 17       40   50.00%");
+    progress = parse(lines);
+    // then
+    EXPECT_TRUE( equals(progress.incumbent, 6.0) );
+    EXPECT_TRUE( equals(progress.bestBound, 3.0) );
+}
+
+TEST_F(TestGAMSSolverLogParser, testGurobiNodeLog) {
+    // given
+    std::vector<std::string> lines = {
+        "    Nodes    |    Current Node    |     Objective Bounds      |     Work",
+        " Expl Unexpl |  Obj  Depth IntInf | Incumbent    BestBd   Gap | It/Node Time",
+        "",
+        "     0     0    2.00000    0   12          -    2.00000      -     -    0s"
+    };
+    // when
+    GAMSSolverProgress progress = parse(lines);
+    // then
+    EXPECT_TRUE( std::isnan(progress.incumbent) );
+
+    // when
+    lines.push_back("H    0     0                      26.0000000    2.00000  92.3%     -    0s");
+    progress = parse(lines);
+    // then
+    EXPECT_TRUE( equals(progress.incumbent, 26.0) );
+    EXPECT_TRUE( equals(progress.bestBound, 2.0) );
+
+    // when
+    lines.push_back("     0     2    2.00000    0   12   26.00000    2.00000  92.3%     -    0s");
+    lines.push_back("*   10     3               4       6.0000000    2.50000  58.3%   5.0    0s");
+    progress = parse(lines);
+    // then
+    EXPECT_TRUE( equals(progress.incumbent, 6.0) );
+    EXPECT_TRUE( equals(progress.bestBound, 2.5) );
+}
@@ -28,6 +28,8 @@
 #include "gamsexception.h"
 #include "gamsset.h"
 #include "gamsparameter.h"
+#include "gamsparameterrecord.h"
+#include "gamsjob.h"
 #include "gamsoptions.h"
 #include "gamsworkspace.h"
 #include "gamsworkspaceinfo.h"
@@ -39,6 +41,10 @@
 #include <fstream>
 #include <string>
 #include <sstream>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <mutex>
 #include <limits.h>
 
 #ifdef _WIN32
@@ -410,6 +416,45 @@ TEST_F(TestGAMSWorkspace, testConstructorFromOccupiedWorkingDirectory) {
     EXPECT_THROW( GAMSWorkspace ws2(wsInfo), GAMSException);
 }
 
+TEST_F(TestGAMSWorkspace, testConstructorFromLinkedWorkingDirectory) {
+#ifdef _WIN32
+    GTEST_SKIP() << "Creating symbolic links needs extra privileges on Windows";
+#endif
+    // given
+    fs::path dir = fs::temp_directory_path() / "testLinkedWorkingDirectory";
+    fs::path link = fs::temp_directory_path() / "testLinkedWorkingDirectoryLink";
+    fs::remove_all(dir);
+    fs::remove(link);
+    fs::create_directories(dir);
+    fs::create_directory_symlink(dir, link);
+    testCleanupDirs.insert(dir.string());
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    wsInfo.setWorkingDirectory(dir.string());
+    GAMSWorkspaceInfo linkInfo("", testSystemDir);
+    linkInfo.setWorkingDirectory(link.string());
+    {
+        GAMSWorkspace ws1(wsInfo);
+        // when creating a workspace from a link to a working directory in use, then
+        EXPECT_THROW( GAMSWorkspace ws2(linkInfo), GAMSException);
+    }
+    // when the first workspace is gone, then
+    EXPECT_NO_THROW( GAMSWorkspace ws3(linkInfo) );
+    fs::remove(link);
+}
+
+TEST_F(TestGAMSWorkspace, testRepeatedWorkspaceCreation) {
+    // given, the first workspace probes the system directory
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace first(wsInfo);
+    const int count = 50;
+    // when
+    for (int i = 0; i < count; ++i) {
+        GAMSWorkspace ws(wsInfo);
+        // then
+        EXPECT_EQ( ws.systemDirectory(), first.systemDirectory() );
+    }
+}
+
 TEST_F(TestGAMSWorkspace, testGetGAMSVersion) {
     // given
     GAMSWorkspaceInfo wsInfo("", testSystemDir);
@@ -510,6 +555,218 @@ TEST_F(TestGAMSWorkspace, testSetMyEPS) {
     EXPECT_EQ(  ws.myEPS(), myEPS );
 }
 
+TEST_F(TestGAMSWorkspace, testJobStatsHistogram) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    // when, then
+    EXPECT_FALSE( ws.collectJobStats() );
+    // when
+    ws.setCollectJobStats(true);
+    ws.addJobFromGamsLib("trnsport").run();
+    ws.addJobFromGamsLib("trnsport").run();
+    // then
+    EXPECT_TRUE( ws.collectJobStats() );
+    for (int phase = 0; phase < GAMSJobStats::cPhaseCount; ++phase) {
+        std::vector<int> histogram = ws.jobStatsHistogram(GAMSJobStats::Phase(phase));
+        EXPECT_EQ( std::accumulate(histogram.begin(), histogram.end(), 0), 2 );
+    }
+    // when
+    ws.resetJobStatsHistogram();
+    std::vector<int> histogram = ws.jobStatsHistogram(GAMSJobStats::Total);
+    // then
+    EXPECT_EQ( std::accumulate(histogram.begin(), histogram.end(), 0), 0 );
+}
+
+static int countScratchFiles(GAMSWorkspace &ws, const std::string &kind)
+{
+    int count = 0;
+    for (const auto &entry : std::filesystem::directory_iterator(ws.workingDirectory())) {
+        std::string name = entry.path().filename().string();
+        if (name.rfind(ws.scratchFilePrefix() + kind, 0) == 0)
+            count++;
+    }
+    return count;
+}
+
+TEST_F(TestGAMSWorkspace, testGetCompileCache) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    // when, then
+    EXPECT_FALSE( ws.compileCache() );
+    // when
+    ws.setCompileCache(true);
+    // then
+    EXPECT_TRUE( ws.compileCache() );
+}
+
+TEST_F(TestGAMSWorkspace, testCompileCache) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    ws.setCompileCache(true);
+    std::string source = "Scalar x, y; execute_load 'ccdata.gdx', x; y = 2*x;";
+    std::string dataFile = (GAMSPath(ws.workingDirectory()) / "ccdata.gdx").toStdString();
+    for (double x : { 1.0, 2.0, 3.0 }) {
+        GAMSDatabase data = ws.addDatabase();
+        data.addParameter("x", 0).addRecord().setValue(x);
+        data.doExport(dataFile);
+        GAMSJob job = ws.addJobFromString(source);
+        // when
+        job.run();
+        // then
+        EXPECT_EQ( job.outDB().getParameter("y").firstRecord().value(), 2*x );
+    }
+    EXPECT_EQ( countScratchFiles(ws, "cc_"), 1 );
+
+    // when
+    ws.addJobFromString(source + " Scalar z;").run();
+    // then
+    EXPECT_EQ( countScratchFiles(ws, "cc_"), 2 );
+}
+
+TEST_F(TestGAMSWorkspace, testCompileCacheSkipsCompileTimeData) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    ws.setCompileCache(true);
+    GAMSDatabase data = ws.addDatabase();
+    data.addParameter("x", 0).addRecord().setValue(4);
+    data.doExport((GAMSPath(ws.workingDirectory()) / "ccdata.gdx").toStdString());
+    GAMSJob job = ws.addJobFromString("Scalar x;\n$gdxIn ccdata.gdx\n$load x\n$gdxIn\n");
+    // when
+    job.run();
+    // then
+    EXPECT_EQ( job.outDB().getParameter("x").firstRecord().value(), 4 );
+    EXPECT_EQ( countScratchFiles(ws, "cc_"), 0 );
+}
+
+TEST_F(TestGAMSWorkspace, testCompileCacheSkipsCompileTimeFileAccess) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    ws.setCompileCache(true);
+    const std::vector<std::string> sources = {
+        "$onEchoV > ccecho.txt\nx\n$offEcho\nScalar y /1/;\n",
+        "$onEchoS > ccecho.txt\nx\n$offEcho\nScalar y /1/;\n",
+        "File f / ccput.txt /; put f;\n$onPutS\nx\n$offPut\nputclose f;\n",
+        "File f / ccput.txt /; put f;\n$onPutV\nx\n$offPut\nputclose f;\n",
+        "$echo x > ccecho.txt\nScalar y /1/;\n",
+        "$echoN x > ccecho.txt\nScalar y /1/;\n",
+        "Set i /a/; Parameter p(i) /a 1/;\n$gdxOut ccidx.gdx\n$unload i p\n$gdxOut\n",
+        "Set i; Parameter p(i);\n$gdxIn ccidx.gdx\n$loadIdx p\n$gdxIn\n",
+        "$if exist ccnofile.txt $abort unexpected\nScalar y /1/;\n",
+        "$ifThen dExist ccnodir\n$abort unexpected\n$endIf\nScalar y /1/;\n",
+        "$ifThenI not exist ccnofile.txt\nScalar y /1/;\n$endIf\n"
+    };
+    for (const std::string &source : sources) {
+        // when
+        ws.addJobFromString(source).run();
+        // then
+        EXPECT_EQ( countScratchFiles(ws, "cc_"), 0 ) << source;
+    }
+}
+
+TEST_F(TestGAMSWorkspace, testGetOptionFileCache) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    // when, then
+    EXPECT_FALSE( ws.optionFileCache() );
+    // when
+    ws.setOptionFileCache(true);
+    // then
+    EXPECT_TRUE( ws.optionFileCache() );
+}
+
+TEST_F(TestGAMSWorkspace, testGetModelInstanceDirectory) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    // when, then
+    EXPECT_TRUE( ws.modelInstanceDirectory().empty() );
+    // when
+    std::string dir = std::filesystem::temp_directory_path().string();
+    ws.setModelInstanceDirectory(dir);
+    // then
+    EXPECT_EQ( ws.modelInstanceDirectory(), dir );
+}
+
+TEST_F(TestGAMSWorkspace, testGetScratchFileRetention) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    // when, then
+    EXPECT_EQ( ws.scratchFileRetentionCount(), -1 );
+    EXPECT_EQ( ws.scratchFileRetentionBytes(), 0u );
+    // when
+    ws.setScratchFileRetentionCount(10);
+    ws.setScratchFileRetentionBytes(1 << 20);
+    // then
+    EXPECT_EQ( ws.scratchFileRetentionCount(), 10 );
+    EXPECT_EQ( ws.scratchFileRetentionBytes(), 1u << 20 );
+}
+
+TEST_F(TestGAMSWorkspace, testScratchFileRetention) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    ws.setScratchFileRetentionCount(1);
+    GAMSPath workingDir(ws.workingDirectory());
+    std::string source = "Scalar x / 1 /;";
+    GAMSJob kept = ws.addJobFromString(source, "kept");
+    kept.run();
+    {
+        GAMSDatabase db = ws.addDatabase("retentiondb");
+        db.addParameter("y", 0).addRecord().setValue(2);
+        GAMSOptions opt = ws.addOptions();
+        ws.addJobFromString(source, "first").run(opt, db);
+    }
+    ws.addJobFromString(source, "second").run();
+    // when
+    ws.cleanScratchFiles();
+    // then
+    EXPECT_FALSE( GAMSPath::exists(workingDir / "first.gms") );
+    EXPECT_FALSE( GAMSPath::exists(workingDir / "first.lst") );
+    EXPECT_FALSE( GAMSPath::exists(workingDir / "retentiondb.gdx") );
+    EXPECT_TRUE( GAMSPath::exists(workingDir / "second.gms") );
+    EXPECT_TRUE( GAMSPath::exists(workingDir / "second.lst") );
+    EXPECT_TRUE( GAMSPath::exists(workingDir / "kept.gms") );
+    EXPECT_TRUE( GAMSPath::exists(workingDir / "kept.lst") );
+    EXPECT_EQ( kept.outDB().getParameter("x").firstRecord().value(), 1 );
+}
+
+TEST_F(TestGAMSWorkspace, testOptionFileCache) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    ws.setOptionFileCache(true);
+    GAMSOptions opt = ws.addOptions();
+    opt.setDefine("value", "3");
+    std::string source = "Scalar x / %value% /;";
+    for (int i = 0; i < 3; ++i) {
+        GAMSJob job = ws.addJobFromString(source);
+        // when
+        job.run(opt);
+        // then
+        EXPECT_EQ( job.outDB().getParameter("x").firstRecord().value(), 3 );
+        EXPECT_EQ( job.lastRunStats().optionFileCacheHit, i > 0 );
+        EXPECT_EQ( job.lastRunStats().scratchFiles, i > 0 ? 0 : 1 );
+        EXPECT_FALSE( GAMSPath::exists(GAMSPath(ws.workingDirectory()) / (job.name() + ".pf")) );
+    }
+    EXPECT_EQ( countScratchFiles(ws, "pf_"), 1 );
+
+    // when
+    opt.setDefine("value", "4");
+    GAMSJob job = ws.addJobFromString(source);
+    job.run(opt);
+    // then
+    EXPECT_EQ( job.outDB().getParameter("x").firstRecord().value(), 4 );
+    EXPECT_FALSE( job.lastRunStats().optionFileCacheHit );
+    EXPECT_EQ( countScratchFiles(ws, "pf_"), 2 );
+}
+
 class ParameterizedTestAddDatabaseFromGDX1
         : public ::testing::WithParamInterface<std::tuple<std::string, std::string, std::string, bool>>,
           public TestGAMSWorkspace {
@@ -749,6 +1006,47 @@ TEST_P(ParameterizedTestAddCheckpoint_Name,  testAddCheckpoint_Name) {
        ASSERT_TRUE( cp.name().find(defaultScratchFilePrefix) == 0 );
 }
 
+TEST_F(TestGAMSWorkspace, testDefaultNamesSkipRegisteredNames) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    std::string taken = ws.scratchFilePrefix() + "gdb0";
+    GAMSDatabase db1 = ws.addDatabase(taken);
+    // when
+    GAMSDatabase db2 = ws.addDatabase();
+    // then
+    EXPECT_EQ( db1.name(), taken );
+    EXPECT_NE( db2.name(), taken );
+    EXPECT_THROW( ws.addDatabase(taken), GAMSException );
+}
+
+TEST_F(TestGAMSWorkspace, testConcurrentNameRegistration) {
+    // given
+    GAMSWorkspaceInfo wsInfo("", testSystemDir);
+    GAMSWorkspace ws(wsInfo);
+    const int threadCount = 64;
+    const int objectCount = 50;
+    std::mutex namesLock;
+    std::set<std::string> names;
+    // when, all threads create databases and checkpoints with default names at the same time
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<std::string> local;
+            for (int i = 0; i < objectCount; ++i) {
+                local.push_back(ws.addDatabase().name());
+                local.push_back(ws.addCheckpoint().name());
+            }
+            std::lock_guard<std::mutex> lck(namesLock);
+            names.insert(local.begin(), local.end());
+        });
+    }
+    for (std::thread &t : threads)
+        t.join();
+    // then
+    EXPECT_EQ( names.size(), size_t(2 * threadCount * objectCount) );
+}
+
 TEST_F(TestGAMSWorkspace, testAddJobFromFile) {
     // given
     GAMSWorkspaceInfo wsInfo("", testSystemDir);